@@ -0,0 +1,68 @@
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+#include "RandomBootstrap.hpp"
+
+// Bootstrap distribution of the mean: n observations, B replicates.
+// Usage: bench_bootstrap [n] [B] [threads]   (defaults 10^6, 10^4, all cores)
+// The naive baseline copies each replicate with uniform_int(0, n-1); it is
+// timed on a few replicates and extrapolated to B.
+
+static double seconds_since(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char** argv) {
+    size_t n = argc > 1 ? std::atol(argv[1]) : 1000000;
+    size_t B = argc > 2 ? std::atol(argv[2]) : 10000;
+    int threads = argc > 3 ? std::atoi(argv[3]) : std::thread::hardware_concurrency();
+    if (threads < 1) threads = 1;
+
+    Random rng(42);
+    std::vector<double> data(n);
+    for (size_t i = 0; i < n; ++i) {
+        data[i] = rng.normal(0, 1);
+    }
+
+    size_t naive_reps = B < 10 ? B : 10;
+    std::vector<double> copy(n);
+    double naive_sink = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (size_t b = 0; b < naive_reps; ++b) {
+        for (size_t i = 0; i < n; ++i) {
+            copy[i] = data[rng.uniform_int(0, n - 1)];
+        }
+        double sum = 0;
+        for (double x : copy) sum += x;
+        naive_sink += sum / n;
+    }
+    double naive = seconds_since(start) / naive_reps;
+
+    Bootstrap bs(n, B, rng);
+    std::vector<double> means(B);
+    start = std::chrono::steady_clock::now();
+    bs.means(data.data(), means.data(), 1);
+    double serial = seconds_since(start);
+
+    start = std::chrono::steady_clock::now();
+    bs.means(data.data(), means.data(), threads);
+    double parallel = seconds_since(start);
+
+    double mean = 0, var = 0;
+    for (double m : means) mean += m;
+    mean /= B;
+    for (double m : means) var += (m - mean) * (m - mean);
+    var /= B > 1 ? B - 1 : 1;
+
+    std::printf("n = %zu, B = %zu\n", n, B);
+    std::printf("naive copy       %8.3f s  (extrapolated, %.2f ns/draw, checksum %g)\n",
+                naive * B, naive * 1e9 / n, naive_sink);
+    std::printf("counts, 1 thread %8.3f s  (%.2f ns/draw)\n", serial, serial * 1e9 / (double(n) * B));
+    std::printf("counts, %d threads %6.3f s  (%.2f ns/draw)\n", threads, parallel,
+                parallel * 1e9 / (double(n) * B));
+    std::printf("bootstrap SE of the mean %g (theory %g)\n", std::sqrt(var), 1 / std::sqrt(double(n)));
+    return 0;
+}
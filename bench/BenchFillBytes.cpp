@@ -0,0 +1,45 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+#include <vector>
+#include "Random.hpp"
+
+// Throughput of Random::fill_bytes against a per-byte uniform_int loop,
+// with memset as the memory bandwidth reference.
+// Usage: bench_fill_bytes [megabytes] [threads]   (defaults 256, all cores)
+
+template <class F>
+void run(const char* name, size_t bytes, F fill) {
+    auto start = std::chrono::steady_clock::now();
+    fill();
+    double s = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::printf("%-22s %9.3f GB/s\n", name, bytes / s / 1e9);
+}
+
+int main(int argc, char** argv) {
+    size_t mb = argc > 1 ? std::atol(argv[1]) : 256;
+    int threads = argc > 2 ? std::atoi(argv[2]) : std::thread::hardware_concurrency();
+    if (threads < 1) threads = 1;
+    size_t len = mb << 20;
+    std::vector<unsigned char> buf(len + 1);
+    Random rng(42);
+
+    // Touch the pages once so the first timed run does not pay for faults
+    std::memset(buf.data(), 1, buf.size());
+
+    size_t slow_len = len < (size_t(16) << 20) ? len : (size_t(16) << 20);
+    run("uniform_int per byte", slow_len, [&] {
+        for (size_t i = 0; i < slow_len; ++i) {
+            buf[i] = static_cast<unsigned char>(rng.uniform_int(0, 255));
+        }
+    });
+    run("memset", len, [&] { std::memset(buf.data(), 0, len); });
+    run("fill_bytes, 1 thread", len, [&] { rng.fill_bytes(buf.data(), len); });
+    run("fill_bytes, unaligned", len, [&] { rng.fill_bytes(buf.data() + 1, len); });
+    char name[32];
+    std::snprintf(name, sizeof(name), "fill_bytes, %d threads", threads);
+    run(name, len, [&] { rng.fill_bytes(buf.data(), len, threads); });
+    return 0;
+}
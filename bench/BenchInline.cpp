@@ -0,0 +1,38 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include "Random.hpp"
+
+// Scalar draw latency of the Random wrappers. Built twice by CMake
+// (RANDOMLIB_BUILD_BENCHMARKS=ON): bench_inline_shared calls into
+// RandomLib_shared, bench_inline_header uses the header-only target so the
+// wrappers can be inlined into the loops below.
+
+template <class F>
+void run(const char* name, long n, F draw) {
+    double sink = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (long i = 0; i < n; ++i) {
+        sink += draw();
+    }
+    auto stop = std::chrono::steady_clock::now();
+    double ns = std::chrono::duration<double, std::nano>(stop - start).count();
+    std::printf("%-14s %8.2f ns/draw  (checksum %g)\n", name, ns / n, sink);
+}
+
+int main(int argc, char** argv) {
+    long n = argc > 1 ? std::atol(argv[1]) : 20000000;
+    Random rng(42);
+
+#ifdef RANDOM_HEADER_ONLY
+    std::printf("header-only build, %ld draws each\n", n);
+#else
+    std::printf("shared library build, %ld draws each\n", n);
+#endif
+    run("uniform_real", n, [&] { return rng.uniform_real(0, 1); });
+    run("uniform_int", n, [&] { return rng.uniform_int(0, 99); });
+    run("bernoulli", n, [&] { return rng.bernoulli(0.3); });
+    run("exponential", n, [&] { return rng.exponential(2); });
+    run("normal", n, [&] { return rng.normal(0, 1); });
+    return 0;
+}
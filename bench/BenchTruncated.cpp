@@ -0,0 +1,79 @@
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <vector>
+#include "Random.hpp"
+
+// Truncated normal draws at increasing distance from the mean, against the
+// usual retry loop around Random::normal (only run while it is affordable).
+// Usage: bench_truncated [draws]   (default 10^6)
+// Configure with RANDOMLIB_STATS=ON to also report engine words per draw.
+
+static double seconds_since(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+// E[Z | lo <= Z <= hi] for a standard normal Z
+static double truncated_mean(double lo, double hi) {
+    const double pi = 3.14159265358979323846;
+    double pdf_lo = std::exp(-lo * lo / 2), pdf_hi = std::isinf(hi) ? 0 : std::exp(-hi * hi / 2);
+    double mass = 0.5 * (std::erfc(lo / std::sqrt(2.0)) - std::erfc(hi / std::sqrt(2.0)));
+    return (pdf_lo - pdf_hi) / std::sqrt(2 * pi) / mass;
+}
+
+static void run(Random& rng, size_t n, double lo, double hi) {
+    std::vector<double> out(n);
+    rng.reset_stats();
+    auto start = std::chrono::steady_clock::now();
+    rng.truncated_normal(0, 1, lo, hi, out.data(), n);
+    double fast = seconds_since(start) * 1e9 / n;
+    random_counter_t c = rng.stats().dist[RANDOM_DIST_TRUNCATED_NORMAL];
+
+    double mean = 0;
+    for (double x : out) mean += x;
+    mean /= n;
+
+    std::printf("[%5.2f, %5.2f]  %8.2f ns/draw", lo, hi, fast);
+    if (Random::stats_enabled()) {
+        std::printf("  %5.2f words/draw", double(c.engine_words) / n);
+    }
+    std::printf("  mean %.4f (exact %.4f)", mean, truncated_mean(lo, hi));
+
+    // The retry loop needs 1 / P(lo <= Z <= hi) normals per value
+    if (lo <= 3.5) {
+        size_t m = n / 10;
+        volatile double sink = 0;
+        start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < m; ++i) {
+            double z;
+            do {
+                z = rng.normal(0, 1);
+            } while (z < lo || z > hi);
+            sink = sink + z;
+        }
+        std::printf("  retry loop %10.2f ns/draw", seconds_since(start) * 1e9 / m);
+    }
+    std::printf("\n");
+}
+
+int main(int argc, char** argv) {
+    size_t n = argc > 1 ? std::atol(argv[1]) : 1000000;
+    const double inf = std::numeric_limits<double>::infinity();
+    Random rng(42);
+
+    std::printf("one-sided tails\n");
+    for (double a : {0.0, 0.5, 1.0, 2.0, 3.0, 4.0, 6.0, 8.0, 10.0}) {
+        run(rng, n, a, inf);
+    }
+    std::printf("narrow intervals\n");
+    for (double a : {0.0, 2.0, 5.0, 10.0}) {
+        run(rng, n, a, a + 0.05);
+    }
+    std::printf("central intervals\n");
+    run(rng, n, -0.5, 0.5);
+    run(rng, n, -2.0, 1.0);
+    run(rng, n, -3.0, 3.0);
+    return 0;
+}
@@ -0,0 +1,6 @@
+# Package configuration for find_package(RandomLib). Provides the imported
+# targets RandomLib::RandomLib_static, RandomLib::RandomLib_shared and
+# RandomLib::RandomLib_header.
+include(CMakeFindDependencyMacro)
+find_dependency(Threads)
+include("${CMAKE_CURRENT_LIST_DIR}/RandomLibTargets.cmake")
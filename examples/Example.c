@@ -1,7 +1,7 @@
 #include "RandomC.h"
 #include <stdio.h>
 
-// gcc Example.c ../build/libRandomLib_static.a -I../include/ -lstdc++ -lm
+// gcc Example.c ../build/libRandomLib_static.a -I../include/ -I../build/include/ -lstdc++ -lm
 
 int main() {
     int err = 0;
@@ -2,7 +2,7 @@
 #include <vector>
 #include "Random.hpp"
 
-// g++ Example.cpp -I../include -L../build -lRandomLib_shared
+// g++ Example.cpp -I../include -I../build/include -L../build -lRandomLib_shared
 // LD_LIBRARY_PATH=../build ./a.out
 
 int main() {
@@ -6,6 +6,21 @@
 #include <algorithm>
 #include <unordered_set>
 
+#include "RandomStats.h"
+
+#ifdef RANDOM_STATS
+#ifdef RANDOM_STATS_TIMING
+#include <chrono>
+#endif
+#define RANDOM_STATS_SCOPE(d) StatsScope stats_scope_(*this, d)
+#define RANDOM_STATS_ERROR(d) (++stats_.dist[d].errors)
+#define RANDOM_STATS_REJECT(d) (++stats_.dist[d].rejections)
+#else
+#define RANDOM_STATS_SCOPE(d) ((void)0)
+#define RANDOM_STATS_ERROR(d) ((void)0)
+#define RANDOM_STATS_REJECT(d) ((void)0)
+#endif
+
 class Random {
 public:
   Random();
@@ -31,6 +46,14 @@ public:
   double uniform_real(double a, double b);
   double weibull(double a, double b);
 
+  // Distributions restricted to [lo, hi]; lo and hi may be infinite
+  double truncated_normal(double mean, double stddev, double lo, double hi);
+  void truncated_normal(double mean, double stddev, double lo, double hi,
+                        double* out, size_t n);
+  double truncated_exponential(double lambda, double lo, double hi);
+  void truncated_exponential(double lambda, double lo, double hi,
+                             double* out, size_t n);
+
   // Randomly permute the elements in the range
   template <class Iterator>
   void shuffle(Iterator first, Iterator last);
@@ -42,19 +65,77 @@ public:
   void sample(Integer n, Integer r, std::vector<Integer>& results);
   template <class Integer>
   void sample(Integer n, Integer r, Integer* results);
+
+  // Fill a buffer with uniformly random bytes
+  void fill_bytes(void* buf, size_t len, int threads = 1);
+
+  // Instrumentation counters (all zero unless built with RANDOM_STATS)
+  static bool stats_enabled();
+  random_stats_t stats() const;
+  void reset_stats();
 private:
+  static unsigned int get_seed();
+  double standard_truncated_normal(double a, double b);
+  double normal_tail(double a, double b);
+
+#ifdef RANDOM_STATS
+  // Wraps the engine to count how many outputs each call consumes
+  class CountingEngine {
+  public:
+    typedef std::default_random_engine::result_type result_type;
+    static constexpr result_type min() { return std::default_random_engine::min(); }
+    static constexpr result_type max() { return std::default_random_engine::max(); }
+    result_type operator()() { ++words; return engine(); }
+    void seed(unsigned int s) { engine.seed(s); }
+    std::default_random_engine engine;
+    unsigned long long words = 0;
+  };
+
+  // Adds the calls, engine words and time of one public call to its counter
+  class StatsScope {
+  public:
+    StatsScope(Random& r, random_dist_t d)
+      : rng(r), dist(d), words(r.generator.words) {
+#ifdef RANDOM_STATS_TIMING
+      start = std::chrono::steady_clock::now();
+#endif
+    }
+    ~StatsScope() {
+      random_counter_t& c = rng.stats_.dist[dist];
+      ++c.calls;
+      c.engine_words += rng.generator.words - words;
+#ifdef RANDOM_STATS_TIMING
+      c.nanoseconds += std::chrono::duration_cast<std::chrono::nanoseconds>(
+          std::chrono::steady_clock::now() - start).count();
+#endif
+    }
+  private:
+    Random& rng;
+    random_dist_t dist;
+    unsigned long long words;
+#ifdef RANDOM_STATS_TIMING
+    std::chrono::steady_clock::time_point start;
+#endif
+  };
+
+  CountingEngine generator;
+  random_stats_t stats_ = {};
+#else
   std::default_random_engine generator;
+#endif
 };
 
 // Implementations of the templated methods
 
 template <class Iterator>
 void Random::shuffle(Iterator first, Iterator last) {
+	RANDOM_STATS_SCOPE(RANDOM_DIST_SHUFFLE);
 	std::shuffle(first, last, generator);
 }
 
 template <class T>
 void Random::shuffle(T* arr, size_t n) {
+	RANDOM_STATS_SCOPE(RANDOM_DIST_SHUFFLE);
 	std::shuffle(arr, arr+n, generator);
 }
 
@@ -66,6 +147,7 @@ void Random::sample(Integer n, Integer r, std::vector<Integer>& results) {
 
 template <class Integer>
 void Random::sample(Integer n, Integer r, Integer* results) {
+	RANDOM_STATS_SCOPE(RANDOM_DIST_SAMPLE);
 	if (r*(r+1)/2.0 < n) {
 		// Sparse sampling
 		std::unordered_set<Integer> s;
@@ -73,6 +155,8 @@ void Random::sample(Integer n, Integer r, Integer* results) {
 			Integer x = uniform_int(0, n-1);
 			if (s.count(x) == 0) {
 				s.insert(x);
+			} else {
+				RANDOM_STATS_REJECT(RANDOM_DIST_SAMPLE);
 			}
 		}
 		std::copy(s.begin(), s.end(), results);
@@ -91,8 +175,12 @@ void Random::sample(Integer n, Integer r, Integer* results) {
 			denom--;
 			k++;
 		}
-		shuffle(results, results+r);
+		std::shuffle(results, results+r, generator);
 	}
 }
 
+#ifdef RANDOM_HEADER_ONLY
+#include "RandomImpl.hpp"
+#endif
+
 #endif
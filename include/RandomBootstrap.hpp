@@ -0,0 +1,52 @@
+#ifndef _RANDOMBOOTSTRAP
+#define _RANDOMBOOTSTRAP
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include "Random.hpp"
+
+// Bootstrap resampling without copying the data. Replicate b is the
+// multiset of n indices drawn uniformly with replacement from [0, n),
+// available either as the draws themselves or as multinomial counts
+// (counts[i] = how often item i was drawn). Each replicate has its own
+// stream derived from the master seed, so any replicate can be regenerated
+// on its own and results do not depend on the number of threads.
+class Bootstrap {
+public:
+  // Called with the counts of one replicate; returns the statistic
+  typedef std::function<double(const unsigned int* counts, size_t n)> Statistic;
+  // Called with the replicate index and its counts
+  typedef std::function<void(size_t b, const unsigned int* counts)> Visitor;
+
+  Bootstrap(size_t n, size_t replicates, Random& rng);
+  Bootstrap(size_t n, size_t replicates, std::uint64_t master_seed);
+
+  size_t size() const { return n; }
+  size_t replicates() const { return nrep; }
+  std::uint64_t master_seed() const { return master; }
+
+  void counts(size_t b, unsigned int* out) const;
+  void counts(size_t b, std::vector<unsigned int>& out) const;
+  void indices(size_t b, size_t* out) const;
+  void indices(size_t b, std::vector<size_t>& out) const;
+
+  // Visits every replicate's counts on up to `threads` threads. Each call
+  // gets a buffer owned by its thread; replicates are visited in no
+  // particular order when threads > 1.
+  void for_each(const Visitor& fn, int threads = 1) const;
+  // results[b] = stat(counts of replicate b)
+  void compute(const Statistic& stat, double* results, int threads = 1) const;
+  std::vector<double> compute(const Statistic& stat, int threads = 1) const;
+  // results[b] = mean of data under replicate b, as a weighted O(n) sum
+  void means(const double* data, double* results, int threads = 1) const;
+private:
+  void check(size_t b) const;
+
+  size_t n;
+  size_t nrep;
+  std::uint64_t master;
+};
+
+#endif
@@ -1,11 +1,23 @@
 #ifndef RANDOMC_H
 #define RANDOMC_H
 
+#include "RandomStats.h"
+
+#include <stddef.h>
+
 #ifdef __cplusplus
 #include "Random.hpp"
+#include "RandomQuasi.hpp"
+#include "RandomBootstrap.hpp"
 typedef Random random_t;
+typedef Sobol sobol_t;
+typedef Halton halton_t;
+typedef Bootstrap bootstrap_t;
 #else
 typedef void random_t;
+typedef void sobol_t;
+typedef void halton_t;
+typedef void bootstrap_t;
 #endif
 
 #ifdef __cplusplus
@@ -33,11 +45,75 @@ double random_student_t(random_t *gen, double n, int* err);
 int random_uniform_int(random_t *gen, int a, int b, int* err);
 double random_uniform_real(random_t *gen, double a, double b, int* err);
 double random_weibull(random_t *gen, double a, double b, int* err);
+double random_truncated_normal(random_t *gen, double mean, double stddev,
+                               double lo, double hi, int* err);
+double random_truncated_exponential(random_t *gen, double lambda, double lo,
+                                    double hi, int* err);
+void random_truncated_normal_fill(random_t *gen, double mean, double stddev,
+                                  double lo, double hi, double* out, size_t n, int* err);
+void random_truncated_exponential_fill(random_t *gen, double lambda, double lo,
+                                       double hi, double* out, size_t n, int* err);
 
 void random_shuffle(random_t* gen, int* arr, int n);
 void random_sample(random_t* gen, int n, int r, int* results);
 void random_shuffle_long(random_t* gen, long* arr, long n);
 void random_sample_long(random_t* gen, long n, long r, long* results);
+void random_fill_bytes(random_t* gen, void* buf, size_t len);
+void random_fill_bytes_threads(random_t* gen, void* buf, size_t len, int threads);
+
+// Random graphs and sparse matrices (see RandomGraph.hpp). The _csr
+// functions allocate their output arrays with malloc; release them with free().
+typedef void (*random_edge_fn)(long row, long col, void *ctx);
+typedef void (*random_entry_fn)(long row, long col, double value, void *ctx);
+
+void random_gnp_edges(random_t *gen, long n, double p, int directed, int threads,
+                      random_edge_fn fn, void *ctx, int* err);
+long random_gnp_csr(random_t *gen, long n, double p, int directed, int threads,
+                    long **row_ptr, long **col_idx, int* err);
+void random_sparse_matrix_entries(random_t *gen, long rows, long cols, double density,
+                                  int threads, random_entry_fn fn, void *ctx, int* err);
+long random_sparse_matrix_csr(random_t *gen, long rows, long cols, double density,
+                              int threads, long **row_ptr, long **col_idx,
+                              double **values, int* err);
+
+// Quasi-random sequences (see RandomQuasi.hpp). Passing gen = NULL gives the
+// unscrambled sequence; otherwise gen draws the scrambling. A scrambling
+// value other than RANDOM_SCRAMBLE_* sets *err = 1 and returns NULL.
+enum {
+    RANDOM_SCRAMBLE_NONE = 0,
+    RANDOM_SCRAMBLE_OWEN = 1,
+    RANDOM_SCRAMBLE_XOR = 2
+};
+
+sobol_t *random_sobol_new(unsigned int dims, random_t *gen, int scrambling, int* err);
+void random_sobol_free(sobol_t *seq);
+void random_sobol_skip_to(sobol_t *seq, unsigned long long index, int* err);
+void random_sobol_block(sobol_t *seq, size_t n, double* out, int* err);
+void random_sobol_block_normal(sobol_t *seq, size_t n, double* out, int* err);
+
+halton_t *random_halton_new(unsigned int dims, random_t *gen, int* err);
+void random_halton_free(halton_t *seq);
+void random_halton_skip_to(halton_t *seq, unsigned long long index);
+void random_halton_block(halton_t *seq, size_t n, double* out);
+void random_halton_block_normal(halton_t *seq, size_t n, double* out);
+
+double random_normal_quantile(double p, int* err);
+
+// Bootstrap resampling (see RandomBootstrap.hpp)
+typedef double (*random_statistic_fn)(const unsigned int* counts, size_t n, void *ctx);
+
+bootstrap_t *random_bootstrap_new(random_t *gen, size_t n, size_t replicates, int* err);
+bootstrap_t *random_bootstrap_new_seeded(unsigned long long seed, size_t n, size_t replicates, int* err);
+void random_bootstrap_free(bootstrap_t *bs);
+void random_bootstrap_counts(bootstrap_t *bs, size_t b, unsigned int* counts, int* err);
+void random_bootstrap_indices(bootstrap_t *bs, size_t b, size_t* indices, int* err);
+void random_bootstrap_compute(bootstrap_t *bs, random_statistic_fn fn, void *ctx,
+                              double* results, int threads);
+void random_bootstrap_means(bootstrap_t *bs, const double* data, double* results, int threads);
+
+int random_stats_enabled(void);
+void random_stats_snapshot(random_t* gen, random_stats_t* out);
+void random_stats_reset(random_t* gen);
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,41 @@
+#ifndef _RANDOMGRAPH
+#define _RANDOMGRAPH
+
+#include <functional>
+#include <vector>
+
+#include "Random.hpp"
+
+// Random graph and sparse matrix generators. Successes are reached by
+// geometric skips, so the expected cost is O(n + m) instead of one Bernoulli
+// trial per candidate entry. Rows are generated in fixed blocks with their
+// own streams; for a given generator state the output is the same for any
+// number of threads. Entries are always produced in row-major order with
+// increasing column indices.
+
+typedef std::function<void(long row, long col)> RandomEdgeCallback;
+typedef std::function<void(long row, long col, double value)> RandomEntryCallback;
+
+// Erdos-Renyi G(n, p). Undirected graphs emit each edge once as (i, j) with
+// j < i; directed graphs emit every ordered pair (i, j), i != j, with
+// probability p. Self loops are never generated.
+void gnp_edges(Random& rng, long n, double p, bool directed,
+               const RandomEdgeCallback& emit, int threads = 1);
+void gnp_coo(Random& rng, long n, double p, bool directed,
+             std::vector<long>& rows, std::vector<long>& cols, int threads = 1);
+void gnp_csr(Random& rng, long n, double p, bool directed,
+             std::vector<long>& row_ptr, std::vector<long>& col_idx,
+             int threads = 1);
+
+// rows x cols matrix where each entry is nonzero with probability `density`.
+// Nonzero values are uniform on [0, 1).
+void sparse_matrix_entries(Random& rng, long rows, long cols, double density,
+                           const RandomEntryCallback& emit, int threads = 1);
+void sparse_matrix_coo(Random& rng, long rows, long cols, double density,
+                       std::vector<long>& row_idx, std::vector<long>& col_idx,
+                       std::vector<double>& values, int threads = 1);
+void sparse_matrix_csr(Random& rng, long rows, long cols, double density,
+                       std::vector<long>& row_ptr, std::vector<long>& col_idx,
+                       std::vector<double>& values, int threads = 1);
+
+#endif
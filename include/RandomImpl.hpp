@@ -0,0 +1,733 @@
+#ifndef _RANDOMIMPL
+#define _RANDOMIMPL
+
+// Definitions of the non-template Random members. The compiled libraries
+// build them once in src/Random.cpp; with RANDOM_HEADER_ONLY they are
+// included from Random.hpp as inline functions so the compiler can inline
+// the engine step and parameter checks into the caller.
+
+#include "Random.hpp"
+#include "RandomSplitMix.hpp"
+#include "RandomThreads.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+
+#ifdef RANDOM_HEADER_ONLY
+#define RANDOM_INLINE inline
+#else
+#define RANDOM_INLINE
+#endif
+
+// Optional: generate seeds using BSD's generator
+#ifdef BSD_HEADERS
+extern "C" {
+#include <bsd/stdlib.h> // Need to install libbsd-dev on Ubuntu
+}
+#endif
+
+// Returns a seed for the random number generator
+RANDOM_INLINE unsigned int Random::get_seed() {
+#ifdef BSD_HEADERS
+  return arc4random();
+#else
+  // Use the system time as a seed
+  return std::chrono::system_clock::now().time_since_epoch().count();
+#endif
+}
+
+RANDOM_INLINE void Random::seed() { seed(get_seed()); }
+
+RANDOM_INLINE void Random::seed(unsigned int s) { generator.seed(s); }
+
+RANDOM_INLINE Random::Random() { seed(); }
+
+RANDOM_INLINE Random::Random(unsigned int s) { seed(s); }
+
+/**
+ * @brief Reports whether the instrumentation counters are compiled in.
+ *
+ * @return true if the library was built with RANDOM_STATS.
+ */
+RANDOM_INLINE bool Random::stats_enabled() {
+#ifdef RANDOM_STATS
+  return true;
+#else
+  return false;
+#endif
+}
+
+/**
+ * @brief Returns a snapshot of the instrumentation counters.
+ *
+ * Counters are kept per Random object and indexed by random_dist_t. Engine
+ * words are inclusive: shuffle and sample also count the words consumed by
+ * the draws they make internally. Without RANDOM_STATS all counters are zero.
+ *
+ * @return A copy of the counters accumulated since construction or the last
+ * reset_stats().
+ */
+RANDOM_INLINE random_stats_t Random::stats() const {
+#ifdef RANDOM_STATS
+  return stats_;
+#else
+  random_stats_t s = {};
+  return s;
+#endif
+}
+
+/**
+ * @brief Sets all instrumentation counters back to zero.
+ */
+RANDOM_INLINE void Random::reset_stats() {
+#ifdef RANDOM_STATS
+  stats_ = random_stats_t();
+#endif
+}
+
+RANDOM_INLINE const char *random_dist_name(random_dist_t dist) {
+  static const char *const names[RANDOM_DIST_COUNT] = {
+      "bernoulli", "binomial", "cauchy", "chi_squared", "exponential",
+      "extreme_value", "fisher_f", "gamma", "geometric", "lognormal",
+      "negative_binomial", "normal", "poisson", "student_t", "uniform_int",
+      "uniform_real", "weibull", "shuffle", "sample", "fill_bytes",
+      "truncated_normal", "truncated_exponential"};
+  if (dist < 0 || dist >= RANDOM_DIST_COUNT)
+    return nullptr;
+  return names[dist];
+}
+
+/**
+ * @brief Generates a random variate from a Bernoulli distribution.
+ *
+ * This function generates a random boolean value from a Bernoulli distribution
+ * with the specified probability of success.
+ *
+ * @param p The probability of returning true. Must be in the range [0, 1].
+ *
+ * @return A random variate from the Bernoulli distribution (true or false).
+ *
+ * @throws std::invalid_argument If p is not in the range [0, 1].
+ */
+RANDOM_INLINE bool Random::bernoulli(double p) {
+  RANDOM_STATS_SCOPE(RANDOM_DIST_BERNOULLI);
+  if (p < 0 || p > 1) {
+    RANDOM_STATS_ERROR(RANDOM_DIST_BERNOULLI);
+    throw std::invalid_argument("Probability must be in the range [0, 1]");
+  }
+  std::bernoulli_distribution d(p);
+  return d(generator);
+}
+
+/**
+ * @brief Generates a random variate from a binomial distribution.
+ *
+ * This function generates a random integer from a binomial distribution
+ * with the specified number of trials and probability of success.
+ *
+ * @param t The number of trials (upper bound of possible values).
+ * @param p The probability of success for each trial. Must be in the range [0,
+ * 1].
+ *
+ * @return A random variate from the binomial distribution.
+ *
+ * @throws std::invalid_argument If p is not in the range [0, 1].
+ */
+RANDOM_INLINE int Random::binomial(int t, double p) {
+  RANDOM_STATS_SCOPE(RANDOM_DIST_BINOMIAL);
+  if (p < 0 || p > 1) {
+    RANDOM_STATS_ERROR(RANDOM_DIST_BINOMIAL);
+    throw std::invalid_argument("Probability must be in the range [0, 1]");
+  }
+  std::binomial_distribution<int> d(t, p);
+  return d(generator);
+}
+
+/**
+ * @brief Generates a random variate from a Cauchy distribution.
+ *
+ * This function generates a random number from a Cauchy distribution
+ * with the specified location and scale parameters.
+ *
+ * @param a The location of the peak of the distribution.
+ * @param b The scale of the distribution. Must be positive (b > 0).
+ *
+ * @return A random variate from the Cauchy distribution.
+ *
+ * @throws std::invalid_argument If b <= 0.
+ */
+RANDOM_INLINE double Random::cauchy(double a, double b) {
+  RANDOM_STATS_SCOPE(RANDOM_DIST_CAUCHY);
+  if (b <= 0) {
+    RANDOM_STATS_ERROR(RANDOM_DIST_CAUCHY);
+    throw std::invalid_argument("Scale parameter must be positive");
+  }
+  std::cauchy_distribution<double> d(a, b);
+  return d(generator);
+}
+
+/**
+ * @brief Generates a random variate from a chi-squared distribution.
+ *
+ * This function generates a random number from a chi-squared distribution
+ * with the specified number of degrees of freedom.
+ *
+ * @param n The number of degrees of freedom. Must be positive (n > 0).
+ *
+ * @return A random variate from the chi-squared distribution.
+ *
+ * @throws std::invalid_argument If n <= 0.
+ */
+RANDOM_INLINE double Random::chi_squared(double n) {
+  RANDOM_STATS_SCOPE(RANDOM_DIST_CHI_SQUARED);
+  if (n <= 0) {
+    RANDOM_STATS_ERROR(RANDOM_DIST_CHI_SQUARED);
+    throw std::invalid_argument("Degrees of freedom must be positive");
+  }
+  std::chi_squared_distribution<double> d(n);
+  return d(generator);
+}
+
+/**
+ * @brief Generates a random variate from an exponential distribution.
+ *
+ * This function generates a random number from an exponential distribution
+ * with the specified rate parameter.
+ *
+ * @param lambda The average rate of occurrence. Must be positive (lambda > 0).
+ *
+ * @return A random variate from the exponential distribution.
+ *
+ * @throws std::invalid_argument If lambda <= 0.
+ */
+RANDOM_INLINE double Random::exponential(double lambda) {
+  RANDOM_STATS_SCOPE(RANDOM_DIST_EXPONENTIAL);
+  if (lambda <= 0) {
+    RANDOM_STATS_ERROR(RANDOM_DIST_EXPONENTIAL);
+    throw std::invalid_argument("Rate parameter must be positive");
+  }
+  std::exponential_distribution<double> d(lambda);
+  return d(generator);
+}
+
+/**
+ * @brief Generates a random variate from an extreme value distribution.
+ *
+ * This function generates a random number from an extreme value distribution
+ * with the specified location and scale parameters.
+ *
+ * @param a The location parameter of the distribution.
+ * @param b The scale parameter of the distribution. Must be positive (b > 0).
+ *
+ * @return A random variate from the extreme value distribution.
+ *
+ * @throws std::invalid_argument If b <= 0.
+ */
+RANDOM_INLINE double Random::extreme_value(double a, double b) {
+  RANDOM_STATS_SCOPE(RANDOM_DIST_EXTREME_VALUE);
+  if (b <= 0) {
+    RANDOM_STATS_ERROR(RANDOM_DIST_EXTREME_VALUE);
+    throw std::invalid_argument("Scale parameter must be positive");
+  }
+  std::extreme_value_distribution<double> d(a, b);
+  return d(generator);
+}
+
+/**
+ * @brief Generates a random variate from a Fisher-F distribution.
+ *
+ * This function generates a random number from a Fisher-F distribution
+ * with the specified degrees of freedom for numerator and denominator.
+ *
+ * @param m The numerator's degrees of freedom. Must be positive (m > 0).
+ * @param n The denominator's degrees of freedom. Must be positive (n > 0).
+ *
+ * @return A random variate from the Fisher-F distribution.
+ *
+ * @throws std::invalid_argument If m <= 0 or n <= 0.
+ */
+RANDOM_INLINE double Random::fisher_f(double m, double n) {
+  RANDOM_STATS_SCOPE(RANDOM_DIST_FISHER_F);
+  if (m <= 0 || n <= 0) {
+    RANDOM_STATS_ERROR(RANDOM_DIST_FISHER_F);
+    throw std::invalid_argument("Degrees of freedom must be positive");
+  }
+  std::fisher_f_distribution<double> d(m, n);
+  return d(generator);
+}
+
+/**
+ * @brief Generates a random variate from a gamma distribution.
+ *
+ * This function generates a random number from a gamma distribution
+ * with the specified shape and scale parameters.
+ *
+ * @param alpha The shape parameter of the distribution. Must be positive (alpha
+ * > 0).
+ * @param beta The scale parameter of the distribution. Must be positive (beta >
+ * 0).
+ *
+ * @return A random variate from the gamma distribution.
+ *
+ * @throws std::invalid_argument If alpha <= 0 or beta <= 0.
+ */
+RANDOM_INLINE double Random::gamma(double alpha, double beta) {
+  RANDOM_STATS_SCOPE(RANDOM_DIST_GAMMA);
+  if (alpha <= 0 || beta <= 0) {
+    RANDOM_STATS_ERROR(RANDOM_DIST_GAMMA);
+    throw std::invalid_argument("Shape and scale parameters must be positive");
+  }
+  std::gamma_distribution<double> d(alpha, beta);
+  return d(generator);
+}
+
+/**
+ * @brief Generates a random variate from a geometric distribution.
+ *
+ * This function generates a random integer from a geometric distribution
+ * with the specified probability of success.
+ *
+ * @param p The probability of success. Must be in the range (0, 1].
+ *
+ * @return A random variate from the geometric distribution.
+ *
+ * @throws std::invalid_argument If p <= 0 or p > 1.
+ */
+RANDOM_INLINE int Random::geometric(double p) {
+  RANDOM_STATS_SCOPE(RANDOM_DIST_GEOMETRIC);
+  if (p <= 0 || p > 1) {
+    RANDOM_STATS_ERROR(RANDOM_DIST_GEOMETRIC);
+    throw std::invalid_argument("Probability must be in the range (0, 1]");
+  }
+  std::geometric_distribution<int> d(p);
+  return d(generator);
+}
+
+/**
+ * @brief Generates a random variate from a lognormal distribution.
+ *
+ * This function generates a random number from a lognormal distribution
+ * with the specified mean and standard deviation of the underlying
+ * normal distribution.
+ *
+ * @param m The mean of the underlying normal distribution.
+ * @param s The standard deviation of the underlying normal distribution.
+ *          Must satisfy the condition: s > 0.
+ *
+ * @return A random variate from the lognormal distribution.
+ *
+ * @throws std::invalid_argument If s <= 0.
+ */
+RANDOM_INLINE double Random::lognormal(double m, double s) {
+  RANDOM_STATS_SCOPE(RANDOM_DIST_LOGNORMAL);
+  if (s <= 0) {
+    RANDOM_STATS_ERROR(RANDOM_DIST_LOGNORMAL);
+    throw std::invalid_argument("Standard deviation must be positive");
+  }
+  std::lognormal_distribution<double> d(m, s);
+  return d(generator);
+}
+
+/**
+ * @brief Generates a random variate from a negative binomial distribution.
+ *
+ * This function generates a random integer from a negative binomial
+ * distribution with the specified number of unsuccessful trials and probability
+ * of success.
+ *
+ * @param k The number of unsuccessful trials that stops the count.
+ * @param p The probability of success. Must satisfy the condition: 0 <= p <= 1.
+ *
+ * @return A random variate from the negative binomial distribution.
+ *
+ * @throws std::invalid_argument If p < 0 or p > 1.
+ */
+RANDOM_INLINE int Random::negative_binomial(int k, double p) {
+  RANDOM_STATS_SCOPE(RANDOM_DIST_NEGATIVE_BINOMIAL);
+  if (p < 0 || p > 1) {
+    RANDOM_STATS_ERROR(RANDOM_DIST_NEGATIVE_BINOMIAL);
+    throw std::invalid_argument("Probability must be between 0 and 1");
+  }
+  std::negative_binomial_distribution<int> d(k, p);
+  return d(generator);
+}
+
+/**
+ * @brief Generates a random variate from a normal distribution.
+ *
+ * This function generates a random number from a normal distribution
+ * with the specified mean and standard deviation.
+ *
+ * @param mean The mean of the distribution (expected value).
+ * @param stddev The standard deviation of the distribution. Must satisfy the
+ * condition: stddev > 0.
+ *
+ * @return A random variate from the normal distribution.
+ *
+ * @throws std::invalid_argument If stddev <= 0.
+ */
+RANDOM_INLINE double Random::normal(double mean, double stddev) {
+  RANDOM_STATS_SCOPE(RANDOM_DIST_NORMAL);
+  if (stddev <= 0) {
+    RANDOM_STATS_ERROR(RANDOM_DIST_NORMAL);
+    throw std::invalid_argument("Standard deviation must be positive");
+  }
+  std::normal_distribution<double> d(mean, stddev);
+  return d(generator);
+}
+
+/**
+ * @brief Generates a random variate from a Poisson distribution.
+ *
+ * This function generates a random integer from a Poisson distribution
+ * with the specified mean.
+ *
+ * @param mean The expected number of events in the interval. Must satisfy the
+ * condition: mean > 0.
+ *
+ * @return A random variate from the Poisson distribution.
+ *
+ * @throws std::invalid_argument If mean <= 0.
+ */
+RANDOM_INLINE int Random::poisson(double mean) {
+  RANDOM_STATS_SCOPE(RANDOM_DIST_POISSON);
+  if (mean <= 0) {
+    RANDOM_STATS_ERROR(RANDOM_DIST_POISSON);
+    throw std::invalid_argument("Mean must be positive");
+  }
+  std::poisson_distribution<int> d(mean);
+  return d(generator);
+}
+
+/**
+ * @brief Generates a random variate from a Student's t-distribution.
+ *
+ * This function generates a random number from a Student's t-distribution
+ * with the specified degrees of freedom.
+ *
+ * @param n The degrees of freedom. Must satisfy the condition: n > 0.
+ *
+ * @return A random variate from the Student's t-distribution.
+ *
+ * @throws std::invalid_argument If n <= 0.
+ */
+RANDOM_INLINE double Random::student_t(double n) {
+  RANDOM_STATS_SCOPE(RANDOM_DIST_STUDENT_T);
+  if (n <= 0) {
+    RANDOM_STATS_ERROR(RANDOM_DIST_STUDENT_T);
+    throw std::invalid_argument("Degrees of freedom must be positive");
+  }
+  std::student_t_distribution<double> d(n);
+  return d(generator);
+}
+
+/**
+ * @brief Generates a random variate from a uniform integer distribution.
+ *
+ * This function generates a random integer from a uniform distribution
+ * in the range [a, b], where both a and b are inclusive.
+ *
+ * @param a The lower bound of the range the distribution can generate
+ * (inclusive).
+ * @param b The upper bound of the range the distribution can generate
+ * (inclusive). Must satisfy the condition: a < b.
+ *
+ * @return A random variate from the uniform integer distribution in the range
+ * [a, b].
+ *
+ * @throws std::invalid_argument If a >= b.
+ */
+RANDOM_INLINE int Random::uniform_int(int a, int b) {
+  RANDOM_STATS_SCOPE(RANDOM_DIST_UNIFORM_INT);
+  if (a >= b) {
+    RANDOM_STATS_ERROR(RANDOM_DIST_UNIFORM_INT);
+    throw std::invalid_argument("Lower bound must be less than upper bound");
+  }
+  std::uniform_int_distribution<int> d(a, b);
+  return d(generator);
+}
+
+/**
+ * @brief Generates a random variate from a uniform real distribution.
+ *
+ * This function generates a random real number from a uniform distribution
+ * in the range [a, b), where a is inclusive and b is exclusive.
+ *
+ * @param a The lower bound of the range the distribution can generate
+ * (inclusive).
+ * @param b The upper bound of the range the distribution can generate
+ * (exclusive). Must satisfy the condition: a <= b.
+ *
+ * @return A random variate from the uniform real distribution in the range [a,
+ * b).
+ *
+ * @throws std::invalid_argument If a > b.
+ */
+RANDOM_INLINE double Random::uniform_real(double a, double b) {
+  RANDOM_STATS_SCOPE(RANDOM_DIST_UNIFORM_REAL);
+  if (a > b) {
+    RANDOM_STATS_ERROR(RANDOM_DIST_UNIFORM_REAL);
+    throw std::invalid_argument(
+        "Lower bound must be less than or equal to upper bound");
+  }
+  std::uniform_real_distribution<double> d(a, b);
+  return d(generator);
+}
+
+/**
+ * @brief Generates a random variate from a Weibull distribution.
+ *
+ * This function generates a random number from a Weibull distribution
+ * with the specified shape and scale parameters.
+ *
+ * @param a The shape of the distribution. Must satisfy the condition: a > 0.
+ * @param b The scale of the distribution. Must satisfy the condition: b > 0.
+ *
+ * @return A random variate from the Weibull distribution.
+ *
+ * @throws std::invalid_argument If a <= 0 or b <= 0.
+ */
+RANDOM_INLINE double Random::weibull(double a, double b) {
+  RANDOM_STATS_SCOPE(RANDOM_DIST_WEIBULL);
+  if (a <= 0 || b <= 0) {
+    RANDOM_STATS_ERROR(RANDOM_DIST_WEIBULL);
+    throw std::invalid_argument("Shape and scale parameters must be positive");
+  }
+  std::weibull_distribution<double> d(a, b);
+  return d(generator);
+}
+
+/**
+ * @brief Fills a buffer with uniformly distributed random bytes.
+ *
+ * A 64-bit key is mixed from exactly three raw engine words, whatever len
+ * is, and the buffer is filled with the words of the
+ * counter-based SplitMix64 stream for that key. Word k always lands at byte
+ * offset 8k, so the contents depend only on the seed and len, not on the
+ * buffer alignment or the number of threads. Words are stored in native
+ * byte order; unaligned heads and the partial tail word are written with
+ * memcpy.
+ *
+ * @param buf The buffer to fill.
+ * @param len The number of bytes to write.
+ * @param threads The number of threads sharing the work. Buffers shorter
+ * than one 1 MiB chunk are always filled by the calling thread.
+ */
+RANDOM_INLINE void Random::fill_bytes(void *buf, size_t len, int threads) {
+  RANDOM_STATS_SCOPE(RANDOM_DIST_FILL_BYTES);
+  const size_t CHUNK_WORDS = (size_t(1) << 20) / 8;
+  // Raw engine calls rather than a distribution, whose rejection loop would
+  // make the number of engine words consumed vary
+  std::uint64_t raw = static_cast<std::uint64_t>(generator());
+  raw = (raw << 31) ^ static_cast<std::uint64_t>(generator());
+  raw = (raw << 31) ^ static_cast<std::uint64_t>(generator());
+  const std::uint64_t key = random_mix64(raw);
+
+  unsigned char *p = static_cast<unsigned char *>(buf);
+  const size_t words = len / 8;
+  const size_t chunks = (words + CHUNK_WORDS - 1) / CHUNK_WORDS;
+  random_parallel_for(chunks, threads, [&](size_t c) {
+    size_t first = c * CHUNK_WORDS;
+    size_t last = std::min(words, first + CHUNK_WORDS);
+    SplitMix64 stream(key, first);
+    for (size_t k = first; k < last; ++k) {
+      std::uint64_t w = stream();
+      std::memcpy(p + 8 * k, &w, 8);
+    }
+  });
+  if (len % 8) {
+    std::uint64_t w = SplitMix64(key, words)();
+    std::memcpy(p + 8 * words, &w, len % 8);
+  }
+}
+
+/**
+ * @brief Samples a standard normal restricted to [a, b] with a >= 0.
+ *
+ * Uses Robert's (1995) optimal proposal: uniform on [a, b] when the
+ * interval is narrow, otherwise a translated exponential with rate
+ * (a + sqrt(a^2 + 4)) / 2. Either way the acceptance rate stays bounded
+ * away from zero however far out a is.
+ */
+RANDOM_INLINE double Random::normal_tail(double a, double b) {
+  // The tail's scale 1/a is far below half an ulp of a, so draws round to a;
+  // returning early also keeps a * a from overflowing into an endless loop
+  if (a > 1e9)
+    return a;
+  std::uniform_real_distribution<double> uniform(0, 1);
+  const double root = std::sqrt(a * a + 4);
+  const double width = 2 * std::sqrt(std::exp(1.0)) / (a + root) *
+                       std::exp((a * a - a * root) / 4);
+  if (b - a <= width) {
+    while (true) {
+      double z = a + (b - a) * uniform(generator);
+      if (uniform(generator) <= std::exp((a * a - z * z) / 2))
+        return z;
+      RANDOM_STATS_REJECT(RANDOM_DIST_TRUNCATED_NORMAL);
+    }
+  }
+  const double alpha = (a + root) / 2;
+  std::exponential_distribution<double> exponential(alpha);
+  while (true) {
+    double z = a + exponential(generator);
+    if (z <= b && uniform(generator) <= std::exp(-(z - alpha) * (z - alpha) / 2))
+      return z;
+    RANDOM_STATS_REJECT(RANDOM_DIST_TRUNCATED_NORMAL);
+  }
+}
+
+/**
+ * @brief Samples a standard normal restricted to [a, b].
+ *
+ * One-sided regions are reflected onto normal_tail(). Intervals around the
+ * mode use uniform rejection when narrower than sqrt(2 pi) and plain normal
+ * rejection otherwise, which then accepts with probability above 0.49.
+ */
+RANDOM_INLINE double Random::standard_truncated_normal(double a, double b) {
+  if (a >= 0)
+    return normal_tail(a, b);
+  if (b <= 0)
+    return -normal_tail(-b, -a);
+  if (b - a < 2.50662827463100050242) {
+    std::uniform_real_distribution<double> uniform(0, 1);
+    while (true) {
+      double z = a + (b - a) * uniform(generator);
+      if (uniform(generator) <= std::exp(-z * z / 2))
+        return z;
+      RANDOM_STATS_REJECT(RANDOM_DIST_TRUNCATED_NORMAL);
+    }
+  }
+  std::normal_distribution<double> normal(0, 1);
+  while (true) {
+    double z = normal(generator);
+    if (z >= a && z <= b)
+      return z;
+    RANDOM_STATS_REJECT(RANDOM_DIST_TRUNCATED_NORMAL);
+  }
+}
+
+/**
+ * @brief Generates a random variate from a truncated normal distribution.
+ *
+ * This function generates a random number from a normal distribution with
+ * the specified mean and standard deviation, conditioned to lie in
+ * [lo, hi]. The expected number of engine draws per variate is bounded for
+ * every truncation region, including intervals far in the tails.
+ *
+ * @param mean The mean of the untruncated distribution. Must be finite.
+ * @param stddev The standard deviation of the untruncated distribution. Must
+ * be finite and satisfy the condition: stddev > 0.
+ * @param lo The lower bound (may be -infinity).
+ * @param hi The upper bound (may be +infinity). Must satisfy the condition:
+ * lo < hi.
+ *
+ * @return A random variate from the truncated normal distribution.
+ *
+ * @throws std::invalid_argument If mean is not finite, stddev is not
+ * positive and finite, or lo >= hi.
+ */
+RANDOM_INLINE double Random::truncated_normal(double mean, double stddev,
+                                              double lo, double hi) {
+  double result;
+  truncated_normal(mean, stddev, lo, hi, &result, 1);
+  return result;
+}
+
+/**
+ * @brief Fills an array with truncated normal variates.
+ *
+ * Equivalent to n calls of truncated_normal(mean, stddev, lo, hi), with the
+ * parameter checks done once.
+ *
+ * @throws std::invalid_argument If mean is not finite, stddev is not
+ * positive and finite, or lo >= hi.
+ */
+RANDOM_INLINE void Random::truncated_normal(double mean, double stddev,
+                                            double lo, double hi, double *out,
+                                            size_t n) {
+  RANDOM_STATS_SCOPE(RANDOM_DIST_TRUNCATED_NORMAL);
+  if (!std::isfinite(mean)) {
+    RANDOM_STATS_ERROR(RANDOM_DIST_TRUNCATED_NORMAL);
+    throw std::invalid_argument("Mean must be finite");
+  }
+  if (!(stddev > 0) || !std::isfinite(stddev)) {
+    RANDOM_STATS_ERROR(RANDOM_DIST_TRUNCATED_NORMAL);
+    throw std::invalid_argument("Standard deviation must be positive and finite");
+  }
+  if (!(lo < hi)) {
+    RANDOM_STATS_ERROR(RANDOM_DIST_TRUNCATED_NORMAL);
+    throw std::invalid_argument("Lower bound must be less than upper bound");
+  }
+  const double a = (lo - mean) / stddev;
+  const double b = (hi - mean) / stddev;
+  if (a == b && std::isinf(a)) {
+    // Both bounds are so many standard deviations out that the rescale
+    // overflowed; all the mass sits at the bound nearest the mean
+    std::fill(out, out + n, a > 0 ? lo : hi);
+    return;
+  }
+  for (size_t i = 0; i < n; ++i) {
+    // Rounding in the rescale must not leave the interval
+    double x = mean + stddev * standard_truncated_normal(a, b);
+    out[i] = std::min(std::max(x, lo), hi);
+  }
+}
+
+/**
+ * @brief Generates a random variate from a truncated exponential
+ * distribution.
+ *
+ * This function generates a random number from an exponential distribution
+ * with the specified rate, conditioned to lie in [lo, hi), by inverting the
+ * truncated CDF. It uses exactly one uniform draw per variate.
+ *
+ * @param lambda The rate parameter. Must satisfy the condition: lambda > 0.
+ * @param lo The lower bound. Must satisfy the condition: lo >= 0.
+ * @param hi The upper bound (may be +infinity). Must satisfy the condition:
+ * lo < hi.
+ *
+ * @return A random variate from the truncated exponential distribution.
+ *
+ * @throws std::invalid_argument If lambda <= 0, lo < 0 or lo >= hi.
+ */
+RANDOM_INLINE double Random::truncated_exponential(double lambda, double lo,
+                                                   double hi) {
+  double result;
+  truncated_exponential(lambda, lo, hi, &result, 1);
+  return result;
+}
+
+/**
+ * @brief Fills an array with truncated exponential variates.
+ *
+ * Equivalent to n calls of truncated_exponential(lambda, lo, hi), with the
+ * parameter checks done once.
+ *
+ * @throws std::invalid_argument If lambda <= 0, lo < 0 or lo >= hi.
+ */
+RANDOM_INLINE void Random::truncated_exponential(double lambda, double lo,
+                                                 double hi, double *out,
+                                                 size_t n) {
+  RANDOM_STATS_SCOPE(RANDOM_DIST_TRUNCATED_EXPONENTIAL);
+  if (!(lambda > 0)) {
+    RANDOM_STATS_ERROR(RANDOM_DIST_TRUNCATED_EXPONENTIAL);
+    throw std::invalid_argument("Rate parameter must be positive");
+  }
+  if (!(lo >= 0 && lo < hi)) {
+    RANDOM_STATS_ERROR(RANDOM_DIST_TRUNCATED_EXPONENTIAL);
+    throw std::invalid_argument("Bounds must satisfy 0 <= lo < hi");
+  }
+  // mass = -(1 - exp(-lambda (hi - lo))), the truncated CDF's scale
+  const double mass = std::expm1(-lambda * (hi - lo));
+  std::uniform_real_distribution<double> uniform(0, 1);
+  for (size_t i = 0; i < n; ++i) {
+    double x = lo - std::log1p(uniform(generator) * mass) / lambda;
+    out[i] = std::min(x, hi);
+  }
+}
+
+#undef RANDOM_INLINE
+
+#endif
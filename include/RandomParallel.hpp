@@ -0,0 +1,27 @@
+#ifndef _RANDOMPARALLEL
+#define _RANDOMPARALLEL
+
+// Helpers for the bulk generators that split their work into fixed blocks.
+// Every block draws from its own stream, seeded from a master seed and the
+// block index, so the output does not depend on how many threads ran it.
+
+#include <climits>
+#include <cstdint>
+
+#include "Random.hpp"
+#include "RandomSplitMix.hpp"
+#include "RandomThreads.hpp"
+
+// Draws a 62-bit master seed for a bulk operation from the generator
+inline std::uint64_t random_master_seed(Random& rng) {
+	std::uint64_t hi = rng.uniform_int(0, INT_MAX);
+	std::uint64_t lo = rng.uniform_int(0, INT_MAX);
+	return (hi << 31) ^ lo;
+}
+
+// 64-bit key of the stream used for the given block of a bulk operation
+inline std::uint64_t random_block_key(std::uint64_t master, std::uint64_t block) {
+	return random_mix64(master + (block + 1) * 0x9e3779b97f4a7c15ULL);
+}
+
+#endif
@@ -0,0 +1,75 @@
+#ifndef _RANDOMQUASI
+#define _RANDOMQUASI
+
+#include <cstdint>
+#include <vector>
+
+#include "Random.hpp"
+
+// Low-discrepancy (quasi-random) point sets for integration-style Monte
+// Carlo. Points are indexed from 0; skip_to() jumps to any index in O(1)
+// per coordinate, so a sequence can be split across threads by giving each
+// thread a copy positioned at the start of its range. Blocks are written
+// row-major: point i occupies out[i*dimensions() .. (i+1)*dimensions()).
+
+// Inverse of the standard normal CDF, for p in (0, 1)
+double normal_quantile(double p);
+
+class Sobol {
+public:
+  enum Scrambling {
+    NONE = 0, // plain Sobol points (point 0 is the origin)
+    OWEN = 1, // hash-based nested uniform (Owen) scrambling
+    XOR = 2   // random digital shift
+  };
+
+  // Dimensions covered by the embedded Joe-Kuo table (degree <= 15)
+  static const unsigned int MAX_DIMENSIONS = 3667;
+
+  explicit Sobol(unsigned int dims);
+  Sobol(unsigned int dims, Random& rng, Scrambling s = OWEN);
+
+  unsigned int dimensions() const { return dims; }
+  std::uint64_t index() const { return n; }
+  void skip_to(std::uint64_t index);
+
+  void next(double* point);                  // uniform on [0, 1)^d
+  void block(size_t count, double* out);
+  void block_normal(size_t count, double* out); // standard normal coordinates
+private:
+  std::uint32_t scramble(std::uint32_t x, unsigned int j) const;
+
+  unsigned int dims;
+  Scrambling scrambling;
+  std::uint64_t n;
+  std::vector<std::uint32_t> v;     // direction numbers, 32 per dimension
+  std::vector<std::uint32_t> x;     // unscrambled coordinates of point n
+  std::vector<std::uint32_t> seeds; // per-dimension scrambling seeds
+};
+
+class Halton {
+public:
+  static const unsigned int MAX_DIMENSIONS = 10000;
+
+  explicit Halton(unsigned int dims);
+  Halton(unsigned int dims, Random& rng); // random affine digit scrambling
+
+  unsigned int dimensions() const { return dims; }
+  std::uint64_t index() const { return n; }
+  void skip_to(std::uint64_t index) { n = index; }
+
+  void next(double* point);                  // uniform on [0, 1)^d
+  void block(size_t count, double* out);
+  void block_normal(size_t count, double* out); // standard normal coordinates
+private:
+  double radical_inverse(std::uint64_t i, unsigned int j) const;
+
+  unsigned int dims;
+  std::uint64_t n;
+  std::vector<unsigned int> bases;       // first dims primes
+  std::vector<unsigned int> offsets;     // start of each dimension's digit maps
+  std::vector<unsigned int> multipliers; // digit d -> (m*d + s) mod base,
+  std::vector<unsigned int> shifts;      // empty if unscrambled
+};
+
+#endif
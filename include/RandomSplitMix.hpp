@@ -0,0 +1,52 @@
+#ifndef _RANDOMSPLITMIX
+#define _RANDOMSPLITMIX
+
+// SplitMix64 mixing and the counter-based stream built on it. Kept free of
+// Random.hpp so that the Random definitions can use it too.
+
+#include <cstdint>
+
+// SplitMix64 finalizer: a bijective mix with good avalanche
+inline std::uint64_t random_mix64(std::uint64_t x) {
+	x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+	x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+	return x ^ (x >> 31);
+}
+
+// Counter-based SplitMix64 stream. Word k of the stream with a given key is
+// random_mix64(key + (k + 1) * golden), so any position is reachable in O(1).
+// Used where a bulk operation needs full 64-bit words faster than the
+// distribution wrappers can deliver them.
+class SplitMix64 {
+public:
+	typedef std::uint64_t result_type;
+	static constexpr result_type min() { return 0; }
+	static constexpr result_type max() { return ~result_type(0); }
+
+	explicit SplitMix64(std::uint64_t key, std::uint64_t position = 0)
+		: state(key + position * GOLDEN) {}
+	result_type operator()() { return random_mix64(state += GOLDEN); }
+
+	// Uniform double in [0, 1) from the top 53 bits of the next word
+	double uniform() { return ((*this)() >> 11) * (1.0 / 9007199254740992.0); }
+
+	// Uniform integer in [0, n) for n > 0, by Lemire's
+	// multiply-and-reject method
+	std::uint32_t bounded(std::uint32_t n) {
+		std::uint64_t m = ((*this)() >> 32) * n;
+		std::uint32_t low = static_cast<std::uint32_t>(m);
+		if (low < n) {
+			std::uint32_t threshold = (0u - n) % n;
+			while (low < threshold) {
+				m = ((*this)() >> 32) * n;
+				low = static_cast<std::uint32_t>(m);
+			}
+		}
+		return static_cast<std::uint32_t>(m >> 32);
+	}
+private:
+	static const std::uint64_t GOLDEN = 0x9e3779b97f4a7c15ULL;
+	std::uint64_t state;
+};
+
+#endif
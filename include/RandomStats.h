@@ -0,0 +1,65 @@
+#ifndef RANDOMSTATS_H
+#define RANDOMSTATS_H
+
+#include "RandomConfig.h"
+
+// Instrumentation counters for the Random class.
+//
+// Counting is compiled in only when RANDOM_STATS is defined (CMake option
+// RANDOMLIB_STATS). Per-call timing additionally requires RANDOM_STATS_TIMING.
+// Both are recorded in the generated RandomConfig.h, so every user of the
+// headers sees the same Random layout as the library.
+// Without RANDOM_STATS the snapshot functions still exist but always report
+// zeros, and the Random class carries no counters at all.
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Distributions and operations tracked by the counters
+typedef enum random_dist {
+    RANDOM_DIST_BERNOULLI,
+    RANDOM_DIST_BINOMIAL,
+    RANDOM_DIST_CAUCHY,
+    RANDOM_DIST_CHI_SQUARED,
+    RANDOM_DIST_EXPONENTIAL,
+    RANDOM_DIST_EXTREME_VALUE,
+    RANDOM_DIST_FISHER_F,
+    RANDOM_DIST_GAMMA,
+    RANDOM_DIST_GEOMETRIC,
+    RANDOM_DIST_LOGNORMAL,
+    RANDOM_DIST_NEGATIVE_BINOMIAL,
+    RANDOM_DIST_NORMAL,
+    RANDOM_DIST_POISSON,
+    RANDOM_DIST_STUDENT_T,
+    RANDOM_DIST_UNIFORM_INT,
+    RANDOM_DIST_UNIFORM_REAL,
+    RANDOM_DIST_WEIBULL,
+    RANDOM_DIST_SHUFFLE,
+    RANDOM_DIST_SAMPLE,
+    RANDOM_DIST_FILL_BYTES,
+    RANDOM_DIST_TRUNCATED_NORMAL,
+    RANDOM_DIST_TRUNCATED_EXPONENTIAL,
+    RANDOM_DIST_COUNT
+} random_dist_t;
+
+typedef struct random_counter {
+    unsigned long long calls;        // number of calls, including failed ones
+    unsigned long long engine_words; // engine outputs consumed by the calls
+    unsigned long long rejections;   // retries of rejection loops owned by the library
+    unsigned long long errors;       // calls rejected with invalid arguments
+    unsigned long long nanoseconds;  // wall time spent in the calls (RANDOM_STATS_TIMING only)
+} random_counter_t;
+
+typedef struct random_stats {
+    random_counter_t dist[RANDOM_DIST_COUNT];
+} random_stats_t;
+
+// Returns a lowercase name for the distribution, or NULL if out of range
+const char *random_dist_name(random_dist_t dist);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // RANDOMSTATS_H
@@ -0,0 +1,50 @@
+#ifndef _RANDOMTHREADS
+#define _RANDOMTHREADS
+
+// Parallel loop used by the bulk generators. Kept free of Random.hpp so
+// that the Random definitions can use it too.
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Calls fn(i) for every i in [0, count) on up to `threads` threads.
+// Blocks are handed out in increasing order; the first exception thrown
+// by fn is rethrown in the calling thread once all workers have stopped.
+template <class F>
+void random_parallel_for(std::size_t count, int threads, F fn) {
+	if (threads <= 1 || count <= 1) {
+		for (std::size_t i = 0; i < count; ++i)
+			fn(i);
+		return;
+	}
+	std::size_t nworkers = std::min<std::size_t>(threads, count);
+	std::atomic<std::size_t> next(0);
+	std::exception_ptr error;
+	std::mutex error_mutex;
+	auto work = [&]() {
+		try {
+			for (std::size_t i = next++; i < count; i = next++)
+				fn(i);
+		} catch (...) {
+			std::lock_guard<std::mutex> lock(error_mutex);
+			if (!error)
+				error = std::current_exception();
+			next = count;
+		}
+	};
+	std::vector<std::thread> workers;
+	for (std::size_t t = 1; t < nworkers; ++t)
+		workers.emplace_back(work);
+	work();
+	for (std::thread& w : workers)
+		w.join();
+	if (error)
+		std::rethrow_exception(error);
+}
+
+#endif
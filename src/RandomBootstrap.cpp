@@ -0,0 +1,166 @@
+#include "RandomBootstrap.hpp"
+#include "RandomParallel.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace {
+
+// Work items per thread in for_each(). Each item is a contiguous range of
+// replicates sharing one counts buffer; several items per thread balance
+// the load while keeping buffer allocations few.
+const size_t CHUNKS_PER_THREAD = 4;
+
+void check_size(size_t n) {
+  if (n == 0)
+    throw std::invalid_argument("Sample size must be positive");
+  if (n > UINT32_MAX)
+    throw std::invalid_argument("Sample size must be less than 2^32");
+}
+
+} // namespace
+
+/**
+ * @brief Creates a bootstrap resampler seeded from a generator.
+ *
+ * @param n The number of observations. Must satisfy 0 < n < 2^32.
+ * @param replicates The number of bootstrap replicates B.
+ * @param rng Generator used to draw the master seed.
+ *
+ * @throws std::invalid_argument If n is out of range.
+ */
+Bootstrap::Bootstrap(size_t n, size_t replicates, Random &rng)
+    : n(n), nrep(replicates) {
+  check_size(n);
+  master = random_master_seed(rng);
+}
+
+/**
+ * @brief Creates a bootstrap resampler from an explicit master seed.
+ *
+ * The same master seed always produces the same replicates.
+ *
+ * @param n The number of observations. Must satisfy 0 < n < 2^32.
+ * @param replicates The number of bootstrap replicates B.
+ * @param master_seed The seed all replicate streams are derived from.
+ *
+ * @throws std::invalid_argument If n is out of range.
+ */
+Bootstrap::Bootstrap(size_t n, size_t replicates, std::uint64_t master_seed)
+    : n(n), nrep(replicates), master(master_seed) {
+  check_size(n);
+}
+
+void Bootstrap::check(size_t b) const {
+  if (b >= nrep)
+    throw std::invalid_argument("Replicate index out of range");
+}
+
+/**
+ * @brief Writes the multinomial counts of replicate b.
+ *
+ * @param b The replicate index. Must be less than replicates().
+ * @param out Array of size() counts that sum to size().
+ *
+ * @throws std::invalid_argument If b >= replicates().
+ */
+void Bootstrap::counts(size_t b, unsigned int *out) const {
+  check(b);
+  std::fill(out, out + n, 0u);
+  SplitMix64 stream(random_block_key(master, b));
+  const std::uint32_t m = static_cast<std::uint32_t>(n);
+  for (size_t k = 0; k < n; ++k)
+    ++out[stream.bounded(m)];
+}
+
+void Bootstrap::counts(size_t b, std::vector<unsigned int> &out) const {
+  out.resize(n);
+  counts(b, out.data());
+}
+
+/**
+ * @brief Writes the indices drawn for replicate b, in draw order.
+ *
+ * The histogram of the indices equals counts(b).
+ *
+ * @param b The replicate index. Must be less than replicates().
+ * @param out Array of size() indices in [0, size()).
+ *
+ * @throws std::invalid_argument If b >= replicates().
+ */
+void Bootstrap::indices(size_t b, size_t *out) const {
+  check(b);
+  SplitMix64 stream(random_block_key(master, b));
+  const std::uint32_t m = static_cast<std::uint32_t>(n);
+  for (size_t k = 0; k < n; ++k)
+    out[k] = stream.bounded(m);
+}
+
+void Bootstrap::indices(size_t b, std::vector<size_t> &out) const {
+  out.resize(n);
+  indices(b, out.data());
+}
+
+/**
+ * @brief Calls fn(b, counts) for every replicate.
+ *
+ * The counts buffer is only valid during the call. With threads > 1, fn is
+ * called concurrently from several threads and must be thread-safe.
+ *
+ * @param fn The visitor.
+ * @param threads The number of threads.
+ */
+void Bootstrap::for_each(const Visitor &fn, int threads) const {
+  size_t chunks =
+      threads > 1 ? std::min(nrep, threads * CHUNKS_PER_THREAD) : 1;
+  random_parallel_for(chunks, threads, [&](size_t c) {
+    std::vector<unsigned int> buf(n);
+    for (size_t b = c * nrep / chunks; b < (c + 1) * nrep / chunks; ++b) {
+      counts(b, buf.data());
+      fn(b, buf.data());
+    }
+  });
+}
+
+/**
+ * @brief Evaluates a statistic on every replicate.
+ *
+ * The statistic receives the replicate's counts, which act as integer
+ * weights on the original observations, so no resampled copy of the data is
+ * made.
+ *
+ * @param stat The statistic. Must be thread-safe if threads > 1.
+ * @param results Array of replicates() values; results[b] belongs to
+ * replicate b.
+ * @param threads The number of threads.
+ */
+void Bootstrap::compute(const Statistic &stat, double *results,
+                        int threads) const {
+  for_each([&](size_t b, const unsigned int *c) { results[b] = stat(c, n); },
+           threads);
+}
+
+std::vector<double> Bootstrap::compute(const Statistic &stat,
+                                       int threads) const {
+  std::vector<double> results(nrep);
+  compute(stat, results.data(), threads);
+  return results;
+}
+
+/**
+ * @brief Computes the bootstrap distribution of the sample mean.
+ *
+ * @param data Array of size() observations.
+ * @param results Array of replicates() means.
+ * @param threads The number of threads.
+ */
+void Bootstrap::means(const double *data, double *results, int threads) const {
+  compute(
+      [data](const unsigned int *c, size_t n) {
+        double sum = 0;
+        for (size_t i = 0; i < n; ++i)
+          sum += c[i] * data[i];
+        return sum / n;
+      },
+      results, threads);
+}
@@ -1,7 +1,25 @@
+#include <cstdlib>
+#include <cstring>
 #include <iostream>
 #include <stdexcept>
 
 #include "RandomC.h"
+#include "RandomGraph.hpp"
+
+namespace {
+
+// Copies a vector into a malloc'd array owned by the C caller
+template <class T>
+T *to_malloc(const std::vector<T> &v) {
+    T *out = static_cast<T *>(std::malloc(std::max<size_t>(v.size(), 1) * sizeof(T)));
+    if (!out)
+        throw std::bad_alloc();
+    if (!v.empty())
+        std::memcpy(out, v.data(), v.size() * sizeof(T));
+    return out;
+}
+
+}
 
 random_t *random_new() {
     return new Random();
@@ -195,6 +213,50 @@ double random_weibull(random_t *gen, double a, double b, int* err) {
     }
 }
 
+double random_truncated_normal(random_t *gen, double mean, double stddev,
+                               double lo, double hi, int* err) {
+    try {
+        double result = gen->truncated_normal(mean, stddev, lo, hi);
+        if (err) *err = 0;
+        return result;
+    } catch (const std::invalid_argument &e) {
+        if (err) *err = 1;
+        return 0.0;
+    }
+}
+
+double random_truncated_exponential(random_t *gen, double lambda, double lo,
+                                    double hi, int* err) {
+    try {
+        double result = gen->truncated_exponential(lambda, lo, hi);
+        if (err) *err = 0;
+        return result;
+    } catch (const std::invalid_argument &e) {
+        if (err) *err = 1;
+        return 0.0;
+    }
+}
+
+void random_truncated_normal_fill(random_t *gen, double mean, double stddev,
+                                  double lo, double hi, double* out, size_t n, int* err) {
+    try {
+        gen->truncated_normal(mean, stddev, lo, hi, out, n);
+        if (err) *err = 0;
+    } catch (const std::invalid_argument &e) {
+        if (err) *err = 1;
+    }
+}
+
+void random_truncated_exponential_fill(random_t *gen, double lambda, double lo,
+                                       double hi, double* out, size_t n, int* err) {
+    try {
+        gen->truncated_exponential(lambda, lo, hi, out, n);
+        if (err) *err = 0;
+    } catch (const std::invalid_argument &e) {
+        if (err) *err = 1;
+    }
+}
+
 void random_shuffle(random_t* gen, int* arr, int n) {
     gen->shuffle(arr, n);
 }
@@ -210,3 +272,230 @@ void random_shuffle_long(random_t* gen, long* arr, long n) {
 void random_sample_long(random_t* gen, long n, long r, long* results) {
     gen->sample(n, r, results);
 }
+
+void random_fill_bytes(random_t* gen, void* buf, size_t len) {
+    gen->fill_bytes(buf, len);
+}
+
+void random_fill_bytes_threads(random_t* gen, void* buf, size_t len, int threads) {
+    gen->fill_bytes(buf, len, threads);
+}
+
+void random_gnp_edges(random_t *gen, long n, double p, int directed, int threads,
+                      random_edge_fn fn, void *ctx, int* err) {
+    try {
+        gnp_edges(*gen, n, p, directed != 0,
+                  [&](long i, long j) { fn(i, j, ctx); }, threads);
+        if (err) *err = 0;
+    } catch (const std::exception &e) {
+        if (err) *err = 1;
+    }
+}
+
+long random_gnp_csr(random_t *gen, long n, double p, int directed, int threads,
+                    long **row_ptr, long **col_idx, int* err) {
+    *row_ptr = nullptr;
+    *col_idx = nullptr;
+    try {
+        std::vector<long> rp, ci;
+        gnp_csr(*gen, n, p, directed != 0, rp, ci, threads);
+        *row_ptr = to_malloc(rp);
+        *col_idx = to_malloc(ci);
+        if (err) *err = 0;
+        return ci.size();
+    } catch (const std::exception &e) {
+        std::free(*row_ptr);
+        *row_ptr = nullptr;
+        if (err) *err = 1;
+        return 0;
+    }
+}
+
+void random_sparse_matrix_entries(random_t *gen, long rows, long cols, double density,
+                                  int threads, random_entry_fn fn, void *ctx, int* err) {
+    try {
+        sparse_matrix_entries(*gen, rows, cols, density,
+                              [&](long i, long j, double v) { fn(i, j, v, ctx); },
+                              threads);
+        if (err) *err = 0;
+    } catch (const std::exception &e) {
+        if (err) *err = 1;
+    }
+}
+
+long random_sparse_matrix_csr(random_t *gen, long rows, long cols, double density,
+                              int threads, long **row_ptr, long **col_idx,
+                              double **values, int* err) {
+    *row_ptr = nullptr;
+    *col_idx = nullptr;
+    *values = nullptr;
+    try {
+        std::vector<long> rp, ci;
+        std::vector<double> v;
+        sparse_matrix_csr(*gen, rows, cols, density, rp, ci, v, threads);
+        *row_ptr = to_malloc(rp);
+        *col_idx = to_malloc(ci);
+        *values = to_malloc(v);
+        if (err) *err = 0;
+        return ci.size();
+    } catch (const std::exception &e) {
+        std::free(*row_ptr);
+        std::free(*col_idx);
+        *row_ptr = nullptr;
+        *col_idx = nullptr;
+        if (err) *err = 1;
+        return 0;
+    }
+}
+
+sobol_t *random_sobol_new(unsigned int dims, random_t *gen, int scrambling, int* err) {
+    if (scrambling != RANDOM_SCRAMBLE_NONE && scrambling != RANDOM_SCRAMBLE_OWEN &&
+        scrambling != RANDOM_SCRAMBLE_XOR) {
+        if (err) *err = 1;
+        return nullptr;
+    }
+    try {
+        sobol_t *seq = gen ? new Sobol(dims, *gen, static_cast<Sobol::Scrambling>(scrambling))
+                           : new Sobol(dims);
+        if (err) *err = 0;
+        return seq;
+    } catch (const std::invalid_argument &e) {
+        if (err) *err = 1;
+        return nullptr;
+    }
+}
+
+void random_sobol_free(sobol_t *seq) {
+    delete seq;
+}
+
+void random_sobol_skip_to(sobol_t *seq, unsigned long long index, int* err) {
+    try {
+        seq->skip_to(index);
+        if (err) *err = 0;
+    } catch (const std::invalid_argument &e) {
+        if (err) *err = 1;
+    }
+}
+
+void random_sobol_block(sobol_t *seq, size_t n, double* out, int* err) {
+    try {
+        seq->block(n, out);
+        if (err) *err = 0;
+    } catch (const std::out_of_range &e) {
+        if (err) *err = 1;
+    }
+}
+
+void random_sobol_block_normal(sobol_t *seq, size_t n, double* out, int* err) {
+    try {
+        seq->block_normal(n, out);
+        if (err) *err = 0;
+    } catch (const std::out_of_range &e) {
+        if (err) *err = 1;
+    }
+}
+
+halton_t *random_halton_new(unsigned int dims, random_t *gen, int* err) {
+    try {
+        halton_t *seq = gen ? new Halton(dims, *gen) : new Halton(dims);
+        if (err) *err = 0;
+        return seq;
+    } catch (const std::invalid_argument &e) {
+        if (err) *err = 1;
+        return nullptr;
+    }
+}
+
+void random_halton_free(halton_t *seq) {
+    delete seq;
+}
+
+void random_halton_skip_to(halton_t *seq, unsigned long long index) {
+    seq->skip_to(index);
+}
+
+void random_halton_block(halton_t *seq, size_t n, double* out) {
+    seq->block(n, out);
+}
+
+void random_halton_block_normal(halton_t *seq, size_t n, double* out) {
+    seq->block_normal(n, out);
+}
+
+double random_normal_quantile(double p, int* err) {
+    try {
+        double result = normal_quantile(p);
+        if (err) *err = 0;
+        return result;
+    } catch (const std::invalid_argument &e) {
+        if (err) *err = 1;
+        return 0.0;
+    }
+}
+
+bootstrap_t *random_bootstrap_new(random_t *gen, size_t n, size_t replicates, int* err) {
+    try {
+        bootstrap_t *bs = new Bootstrap(n, replicates, *gen);
+        if (err) *err = 0;
+        return bs;
+    } catch (const std::invalid_argument &e) {
+        if (err) *err = 1;
+        return nullptr;
+    }
+}
+
+bootstrap_t *random_bootstrap_new_seeded(unsigned long long seed, size_t n, size_t replicates, int* err) {
+    try {
+        bootstrap_t *bs = new Bootstrap(n, replicates, static_cast<std::uint64_t>(seed));
+        if (err) *err = 0;
+        return bs;
+    } catch (const std::invalid_argument &e) {
+        if (err) *err = 1;
+        return nullptr;
+    }
+}
+
+void random_bootstrap_free(bootstrap_t *bs) {
+    delete bs;
+}
+
+void random_bootstrap_counts(bootstrap_t *bs, size_t b, unsigned int* counts, int* err) {
+    try {
+        bs->counts(b, counts);
+        if (err) *err = 0;
+    } catch (const std::invalid_argument &e) {
+        if (err) *err = 1;
+    }
+}
+
+void random_bootstrap_indices(bootstrap_t *bs, size_t b, size_t* indices, int* err) {
+    try {
+        bs->indices(b, indices);
+        if (err) *err = 0;
+    } catch (const std::invalid_argument &e) {
+        if (err) *err = 1;
+    }
+}
+
+void random_bootstrap_compute(bootstrap_t *bs, random_statistic_fn fn, void *ctx,
+                              double* results, int threads) {
+    bs->compute([&](const unsigned int* counts, size_t n) { return fn(counts, n, ctx); },
+                results, threads);
+}
+
+void random_bootstrap_means(bootstrap_t *bs, const double* data, double* results, int threads) {
+    bs->means(data, results, threads);
+}
+
+int random_stats_enabled(void) {
+    return Random::stats_enabled() ? 1 : 0;
+}
+
+void random_stats_snapshot(random_t* gen, random_stats_t* out) {
+    *out = gen->stats();
+}
+
+void random_stats_reset(random_t* gen) {
+    gen->reset_stats();
+}
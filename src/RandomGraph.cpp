@@ -0,0 +1,272 @@
+#include "RandomGraph.hpp"
+#include "RandomParallel.hpp"
+
+#include <cmath>
+#include <stdexcept>
+
+namespace {
+
+// Rows per independently seeded block; fixed so output is thread-count invariant
+const long ROWS_PER_BLOCK = 1024;
+// Blocks buffered per thread before they are emitted in order
+const std::size_t BLOCKS_PER_THREAD = 4;
+
+// Buffered nonzero of a sparse matrix
+struct Entry {
+  long row;
+  long col;
+  double value;
+};
+
+// Buffered edge of a graph, which has no values to store
+struct Edge {
+  long row;
+  long col;
+};
+
+void store(std::vector<Entry> &out, long row, long col, double value) {
+  Entry e = {row, col, value};
+  out.push_back(e);
+}
+
+void store(std::vector<Edge> &out, long row, long col, double) {
+  Edge e = {row, col};
+  out.push_back(e);
+}
+
+void replay(const std::vector<Entry> &in, const RandomEntryCallback &emit) {
+  for (const Entry &e : in)
+    emit(e.row, e.col, e.value);
+}
+
+void replay(const std::vector<Edge> &in, const RandomEntryCallback &emit) {
+  for (const Edge &e : in)
+    emit(e.row, e.col, 0.0);
+}
+
+enum Layout {
+  LOWER,        // columns [0, i) of row i
+  OFF_DIAGONAL, // columns [0, n) except i
+  FULL          // columns [0, ncols)
+};
+
+// Number of failures before the next success of a Bernoulli(p) sequence,
+// drawn by inversion. log_q is log(1 - p). The result is kept in double so
+// that long skips for tiny p cannot overflow.
+double geometric_skip(SplitMix64 &stream, double log_q) {
+  return std::floor(std::log(1.0 - stream.uniform()) / log_q);
+}
+
+// Calls sink(row, col, value) for every nonzero of rows [first, last)
+template <class Sink>
+void generate_block(SplitMix64 &stream, long first, long last, long ncols,
+                    Layout layout, double log_q, bool values,
+                    const Sink &sink) {
+  for (long i = first; i < last; ++i) {
+    long len = layout == LOWER ? i : layout == OFF_DIAGONAL ? ncols - 1 : ncols;
+    double pos = -1;
+    while (true) {
+      pos += 1 + geometric_skip(stream, log_q);
+      if (pos >= len)
+        break;
+      long j = static_cast<long>(pos);
+      if (layout == OFF_DIAGONAL && j >= i)
+        ++j;
+      sink(i, j, values ? stream.uniform() : 0.0);
+    }
+  }
+}
+
+// Generates the nonzeros block by block. A single thread emits them as they
+// are drawn; several threads buffer a wave of blocks as E records and emit
+// them in order, which gives the same output.
+template <class E>
+void generate(Random &rng, long nrows, long ncols, double p, Layout layout,
+              bool values, const RandomEntryCallback &emit, int threads) {
+  if (!(p >= 0 && p <= 1))
+    throw std::invalid_argument("Probability must be in the range [0, 1]");
+  if (nrows < 0 || ncols < 0)
+    throw std::invalid_argument("Dimensions must be non-negative");
+
+  std::uint64_t master = random_master_seed(rng);
+  if (nrows == 0 || ncols == 0 || p == 0)
+    return;
+
+  double log_q = std::log1p(-p);
+  std::size_t nblocks = (nrows + ROWS_PER_BLOCK - 1) / ROWS_PER_BLOCK;
+
+  if (threads <= 1) {
+    for (std::size_t b = 0; b < nblocks; ++b) {
+      long first = b * ROWS_PER_BLOCK;
+      long last = std::min(nrows, first + ROWS_PER_BLOCK);
+      SplitMix64 stream(random_block_key(master, b));
+      generate_block(stream, first, last, ncols, layout, log_q, values, emit);
+    }
+    return;
+  }
+
+  std::size_t wave = threads * BLOCKS_PER_THREAD;
+  std::vector<std::vector<E>> buffers(std::min(wave, nblocks));
+  for (std::size_t w = 0; w < nblocks; w += wave) {
+    std::size_t count = std::min(wave, nblocks - w);
+    random_parallel_for(count, threads, [&](std::size_t k) {
+      std::size_t b = w + k;
+      long first = b * ROWS_PER_BLOCK;
+      long last = std::min(nrows, first + ROWS_PER_BLOCK);
+      SplitMix64 stream(random_block_key(master, b));
+      std::vector<E> &buffer = buffers[k];
+      buffer.clear();
+      generate_block(stream, first, last, ncols, layout, log_q, values,
+                     [&](long i, long j, double v) { store(buffer, i, j, v); });
+    });
+    for (std::size_t k = 0; k < count; ++k)
+      replay(buffers[k], emit);
+  }
+}
+
+// Builds CSR arrays from entries emitted in row-major order
+struct CsrBuilder {
+  CsrBuilder(long nrows, std::vector<long> &row_ptr, std::vector<long> &col_idx,
+             std::vector<double> *values)
+      : row_ptr(row_ptr), col_idx(col_idx), values(values) {
+    row_ptr.assign(nrows + 1, 0);
+    col_idx.clear();
+    if (values)
+      values->clear();
+  }
+  void operator()(long row, long col, double value) {
+    ++row_ptr[row + 1];
+    col_idx.push_back(col);
+    if (values)
+      values->push_back(value);
+  }
+  void finish() {
+    for (std::size_t i = 1; i < row_ptr.size(); ++i)
+      row_ptr[i] += row_ptr[i - 1];
+  }
+  std::vector<long> &row_ptr;
+  std::vector<long> &col_idx;
+  std::vector<double> *values;
+};
+
+} // namespace
+
+/**
+ * @brief Generates the edges of an Erdos-Renyi G(n, p) random graph.
+ *
+ * Each candidate edge is present independently with probability p. The
+ * generator jumps from one edge to the next with geometric skips, so the
+ * expected running time is O(n + m) for m generated edges.
+ *
+ * @param rng Generator that seeds the per-block streams.
+ * @param n The number of vertices. Must be non-negative.
+ * @param p The edge probability. Must be in the range [0, 1].
+ * @param directed If false, each edge is emitted once as (i, j) with j < i.
+ * If true, every ordered pair (i, j) with i != j is a candidate.
+ * @param emit Called with (i, j) for every edge, in row-major order, from the
+ * calling thread.
+ * @param threads The number of threads generating rows.
+ *
+ * @throws std::invalid_argument If n < 0 or p is not in the range [0, 1].
+ */
+void gnp_edges(Random &rng, long n, double p, bool directed,
+               const RandomEdgeCallback &emit, int threads) {
+  generate<Edge>(rng, n, n, p, directed ? OFF_DIAGONAL : LOWER, false,
+           [&](long i, long j, double) { emit(i, j); }, threads);
+}
+
+/**
+ * @brief Generates a G(n, p) random graph as coordinate lists.
+ *
+ * See gnp_edges() for the meaning of the parameters. rows[k] and cols[k] are
+ * the endpoints of the k-th edge.
+ */
+void gnp_coo(Random &rng, long n, double p, bool directed,
+             std::vector<long> &rows, std::vector<long> &cols, int threads) {
+  rows.clear();
+  cols.clear();
+  generate<Edge>(rng, n, n, p, directed ? OFF_DIAGONAL : LOWER, false,
+           [&](long i, long j, double) {
+             rows.push_back(i);
+             cols.push_back(j);
+           },
+           threads);
+}
+
+/**
+ * @brief Generates a G(n, p) random graph in compressed sparse row form.
+ *
+ * See gnp_edges() for the meaning of the parameters. The neighbours of vertex
+ * i are col_idx[row_ptr[i]] to col_idx[row_ptr[i+1]-1]. Undirected graphs
+ * store only the lower triangle.
+ */
+void gnp_csr(Random &rng, long n, double p, bool directed,
+             std::vector<long> &row_ptr, std::vector<long> &col_idx,
+             int threads) {
+  if (n < 0)
+    throw std::invalid_argument("Dimensions must be non-negative");
+  CsrBuilder csr(n, row_ptr, col_idx, nullptr);
+  generate<Edge>(rng, n, n, p, directed ? OFF_DIAGONAL : LOWER, false,
+           std::ref(csr), threads);
+  csr.finish();
+}
+
+/**
+ * @brief Generates the nonzeros of a random sparse matrix.
+ *
+ * Each entry of a rows x cols matrix is nonzero independently with
+ * probability density, with a value uniform on [0, 1). The expected running
+ * time is O(rows + nnz).
+ *
+ * @param rng Generator that seeds the per-block streams.
+ * @param rows The number of rows. Must be non-negative.
+ * @param cols The number of columns. Must be non-negative.
+ * @param density The probability that an entry is nonzero. Must be in the
+ * range [0, 1].
+ * @param emit Called with (row, col, value) for every nonzero, in row-major
+ * order, from the calling thread.
+ * @param threads The number of threads generating rows.
+ *
+ * @throws std::invalid_argument If a dimension is negative or density is not
+ * in the range [0, 1].
+ */
+void sparse_matrix_entries(Random &rng, long rows, long cols, double density,
+                           const RandomEntryCallback &emit, int threads) {
+  generate<Entry>(rng, rows, cols, density, FULL, true, emit, threads);
+}
+
+/**
+ * @brief Generates a random sparse matrix as coordinate lists.
+ *
+ * See sparse_matrix_entries() for the meaning of the parameters.
+ */
+void sparse_matrix_coo(Random &rng, long rows, long cols, double density,
+                       std::vector<long> &row_idx, std::vector<long> &col_idx,
+                       std::vector<double> &values, int threads) {
+  row_idx.clear();
+  col_idx.clear();
+  values.clear();
+  generate<Entry>(rng, rows, cols, density, FULL, true,
+           [&](long i, long j, double v) {
+             row_idx.push_back(i);
+             col_idx.push_back(j);
+             values.push_back(v);
+           },
+           threads);
+}
+
+/**
+ * @brief Generates a random sparse matrix in compressed sparse row form.
+ *
+ * See sparse_matrix_entries() for the meaning of the parameters.
+ */
+void sparse_matrix_csr(Random &rng, long rows, long cols, double density,
+                       std::vector<long> &row_ptr, std::vector<long> &col_idx,
+                       std::vector<double> &values, int threads) {
+  if (rows < 0)
+    throw std::invalid_argument("Dimensions must be non-negative");
+  CsrBuilder csr(rows, row_ptr, col_idx, &values);
+  generate<Entry>(rng, rows, cols, density, FULL, true, std::ref(csr),
+                  threads);
+  csr.finish();
+}
@@ -0,0 +1,353 @@
+#include "RandomQuasi.hpp"
+#include "RandomParallel.hpp"
+#include "RandomSobolTable.hpp"
+
+#include <cmath>
+#include <stdexcept>
+
+namespace {
+
+const unsigned int BITS = 32;
+const std::uint64_t SOBOL_LENGTH = std::uint64_t(1) << BITS;
+const double TWO_POW_M32 = 1.0 / 4294967296.0;
+const double SQRT_2PI = 2.50662827463100050242;
+
+std::uint32_t reverse_bits(std::uint32_t x) {
+  x = ((x >> 1) & 0x55555555u) | ((x & 0x55555555u) << 1);
+  x = ((x >> 2) & 0x33333333u) | ((x & 0x33333333u) << 2);
+  x = ((x >> 4) & 0x0f0f0f0fu) | ((x & 0x0f0f0f0fu) << 4);
+  x = ((x >> 8) & 0x00ff00ffu) | ((x & 0x00ff00ffu) << 8);
+  return (x >> 16) | (x << 16);
+}
+
+// Burley's hash-based Laine-Karras permutation: on bit-reversed input each
+// output bit depends only on the bits above it, as in Owen scrambling
+std::uint32_t laine_karras(std::uint32_t x, std::uint32_t seed) {
+  x += seed;
+  x ^= x * 0x6c50b47cu;
+  x ^= x * 0xb82f1e52u;
+  x ^= x * 0xc7afe638u;
+  x ^= x * 0x8d22f6e6u;
+  return x;
+}
+
+unsigned int trailing_zeros(std::uint64_t n) {
+  unsigned int c = 0;
+  while (!(n & 1)) {
+    n >>= 1;
+    ++c;
+  }
+  return c;
+}
+
+// Keeps inverse-CDF inputs away from 0 so the normal quantile stays finite
+double open_unit(double u) { return std::max(u, std::ldexp(1.0, -33)); }
+
+} // namespace
+
+/**
+ * @brief Computes the inverse of the standard normal CDF.
+ *
+ * Uses Acklam's rational approximation followed by one Halley step, which
+ * gives close to full double precision.
+ *
+ * @param p A probability. Must satisfy the condition: 0 < p < 1.
+ *
+ * @return The value x with P(Z <= x) = p for a standard normal Z.
+ *
+ * @throws std::invalid_argument If p <= 0 or p >= 1.
+ */
+double normal_quantile(double p) {
+  if (!(p > 0 && p < 1))
+    throw std::invalid_argument("Probability must be in the range (0, 1)");
+  static const double a[] = {-3.969683028665376e+01, 2.209460984245205e+02,
+                             -2.759285104469687e+02, 1.383577518672690e+02,
+                             -3.066479806614716e+01, 2.506628277459239e+00};
+  static const double b[] = {-5.447609879822406e+01, 1.615858368580409e+02,
+                             -1.556989798598866e+02, 6.680131188771972e+01,
+                             -1.328068155288572e+01};
+  static const double c[] = {-7.784894002430293e-03, -3.223964580411365e-01,
+                             -2.400758277161838e+00, -2.549732539343734e+00,
+                             4.374664141464968e+00,  2.938163982698783e+00};
+  static const double d[] = {7.784695709041462e-03, 3.224671290700398e-01,
+                             2.445134137142996e+00, 3.754408661907416e+00};
+  const double p_low = 0.02425;
+
+  double x;
+  if (p < p_low || p > 1 - p_low) {
+    double q = std::sqrt(-2 * std::log(p < p_low ? p : 1 - p));
+    x = (((((c[0] * q + c[1]) * q + c[2]) * q + c[3]) * q + c[4]) * q + c[5]) /
+        ((((d[0] * q + d[1]) * q + d[2]) * q + d[3]) * q + 1);
+    if (p > p_low)
+      x = -x;
+  } else {
+    double q = p - 0.5;
+    double r = q * q;
+    x = (((((a[0] * r + a[1]) * r + a[2]) * r + a[3]) * r + a[4]) * r + a[5]) *
+        q /
+        (((((b[0] * r + b[1]) * r + b[2]) * r + b[3]) * r + b[4]) * r + 1);
+  }
+
+  // Halley refinement
+  double e = 0.5 * std::erfc(-x / std::sqrt(2.0)) - p;
+  double u = e * SQRT_2PI * std::exp(x * x / 2);
+  return x - u / (1 + x * u / 2);
+}
+
+/**
+ * @brief Creates an unscrambled Sobol sequence.
+ *
+ * The first dimension is the van der Corput sequence in base 2; the others
+ * use Joe and Kuo's primitive polynomials and initial direction numbers
+ * (new-joe-kuo-6.21201). Up to 2^32 points can be generated.
+ *
+ * @param dims The number of dimensions. Must be in the range [1,
+ * MAX_DIMENSIONS].
+ *
+ * @throws std::invalid_argument If dims is out of range.
+ */
+Sobol::Sobol(unsigned int dims)
+    : dims(dims), scrambling(NONE), n(0) {
+  if (dims < 1 || dims > MAX_DIMENSIONS)
+    throw std::invalid_argument("Dimension must be in the range [1, 3667]");
+  v.resize(std::size_t(dims) * BITS);
+  x.assign(dims, 0);
+
+  for (unsigned int k = 0; k < BITS; ++k)
+    v[k] = std::uint32_t(1) << (BITS - 1 - k);
+
+  // Initial numbers m_1..m_s of dimension j start at offset in the table
+  std::size_t offset = 0;
+  for (unsigned int j = 1; j < dims; ++j) {
+    unsigned int poly = SOBOL_POLYNOMIALS[j - 1];
+    unsigned int s = 0;
+    while (poly >> (s + 1))
+      ++s;
+    // Coefficients of x^(s-1) .. x^1, highest first
+    unsigned int a = (poly >> 1) & ((1u << (s - 1)) - 1);
+    std::uint32_t *vj = &v[std::size_t(j) * BITS];
+    for (unsigned int k = 0; k < s; ++k)
+      vj[k] = std::uint32_t(SOBOL_INITIAL_NUMBERS[offset + k]) << (BITS - 1 - k);
+    offset += s;
+    for (unsigned int k = s; k < BITS; ++k) {
+      vj[k] = vj[k - s] ^ (vj[k - s] >> s);
+      for (unsigned int i = 1; i < s; ++i)
+        if ((a >> (s - 1 - i)) & 1)
+          vj[k] ^= vj[k - i];
+    }
+  }
+}
+
+/**
+ * @brief Creates a scrambled Sobol sequence.
+ *
+ * Owen scrambling applies an independent hash-based nested uniform
+ * permutation to each coordinate; XOR applies a random digital shift. Both
+ * keep the points a (t, s)-sequence while making estimates unbiased.
+ *
+ * @param dims The number of dimensions. Must be in the range [1,
+ * MAX_DIMENSIONS].
+ * @param rng Generator used to draw the per-dimension scrambling seeds.
+ * @param s The scrambling method.
+ *
+ * @throws std::invalid_argument If dims is out of range.
+ */
+Sobol::Sobol(unsigned int dims, Random &rng, Scrambling s) : Sobol(dims) {
+  scrambling = s;
+  if (s == NONE)
+    return;
+  std::uint64_t master = random_master_seed(rng);
+  seeds.resize(dims);
+  for (unsigned int j = 0; j < dims; ++j)
+    seeds[j] = static_cast<std::uint32_t>(random_mix64(master + j) >> 32);
+}
+
+std::uint32_t Sobol::scramble(std::uint32_t y, unsigned int j) const {
+  switch (scrambling) {
+  case OWEN:
+    return reverse_bits(laine_karras(reverse_bits(y), seeds[j]));
+  case XOR:
+    return y ^ seeds[j];
+  default:
+    return y;
+  }
+}
+
+/**
+ * @brief Positions the sequence at the given point index.
+ *
+ * @param index The index of the next point to generate. Must be less than
+ * 2^32.
+ *
+ * @throws std::invalid_argument If index >= 2^32.
+ */
+void Sobol::skip_to(std::uint64_t index) {
+  if (index >= SOBOL_LENGTH)
+    throw std::invalid_argument("Sobol index must be less than 2^32");
+  std::uint64_t gray = index ^ (index >> 1);
+  for (unsigned int j = 0; j < dims; ++j) {
+    std::uint32_t y = 0;
+    for (unsigned int k = 0; k < BITS; ++k)
+      if ((gray >> k) & 1)
+        y ^= v[std::size_t(j) * BITS + k];
+    x[j] = y;
+  }
+  n = index;
+}
+
+/**
+ * @brief Writes the next point, with coordinates in [0, 1), and advances.
+ *
+ * @throws std::out_of_range If all 2^32 points have been generated.
+ */
+void Sobol::next(double *point) {
+  if (n >= SOBOL_LENGTH)
+    throw std::out_of_range("Sobol sequence is exhausted");
+  for (unsigned int j = 0; j < dims; ++j)
+    point[j] = scramble(x[j], j) * TWO_POW_M32;
+  // Gray code order: consecutive points differ by one direction number
+  if (++n < SOBOL_LENGTH) {
+    unsigned int c = trailing_zeros(n);
+    for (unsigned int j = 0; j < dims; ++j)
+      x[j] ^= v[std::size_t(j) * BITS + c];
+  }
+}
+
+/**
+ * @brief Writes the next count points row-major into out.
+ */
+void Sobol::block(size_t count, double *out) {
+  for (size_t i = 0; i < count; ++i)
+    next(out + i * dims);
+}
+
+/**
+ * @brief Writes the next count points mapped to standard normal coordinates.
+ *
+ * Each coordinate is taken at the centre of its 2^-32 cell before the
+ * inverse normal CDF is applied, so the origin maps to a finite point.
+ */
+void Sobol::block_normal(size_t count, double *out) {
+  for (size_t i = 0; i < count; ++i) {
+    if (n >= SOBOL_LENGTH)
+      throw std::out_of_range("Sobol sequence is exhausted");
+    double *point = out + i * dims;
+    for (unsigned int j = 0; j < dims; ++j)
+      point[j] = normal_quantile((scramble(x[j], j) + 0.5) * TWO_POW_M32);
+    if (++n < SOBOL_LENGTH) {
+      unsigned int c = trailing_zeros(n);
+      for (unsigned int j = 0; j < dims; ++j)
+        x[j] ^= v[std::size_t(j) * BITS + c];
+    }
+  }
+}
+
+/**
+ * @brief Creates an unscrambled Halton sequence.
+ *
+ * Dimension j is the radical inverse in the j-th prime base.
+ *
+ * @param dims The number of dimensions. Must be in the range [1,
+ * MAX_DIMENSIONS].
+ *
+ * @throws std::invalid_argument If dims is out of range.
+ */
+Halton::Halton(unsigned int dims) : dims(dims), n(0) {
+  if (dims < 1 || dims > MAX_DIMENSIONS)
+    throw std::invalid_argument("Dimension must be in the range [1, 10000]");
+  for (unsigned int c = 2; bases.size() < dims; ++c) {
+    bool prime = true;
+    for (unsigned int b : bases) {
+      if (b * b > c)
+        break;
+      if (c % b == 0) {
+        prime = false;
+        break;
+      }
+    }
+    if (prime)
+      bases.push_back(c);
+  }
+}
+
+/**
+ * @brief Creates a scrambled Halton sequence.
+ *
+ * Every digit position of every dimension gets its own random affine map
+ * d -> (m*d + s) mod b with m != 0, applied down to double precision.
+ * This breaks the correlations between high dimensions of the plain
+ * sequence.
+ *
+ * @param dims The number of dimensions. Must be in the range [1,
+ * MAX_DIMENSIONS].
+ * @param rng Generator used to draw the digit maps.
+ *
+ * @throws std::invalid_argument If dims is out of range.
+ */
+Halton::Halton(unsigned int dims, Random &rng) : Halton(dims) {
+  offsets.push_back(0);
+  for (unsigned int j = 0; j < dims; ++j) {
+    unsigned int b = bases[j];
+    // Enough digits for any 64-bit index and for 53 bits of precision
+    unsigned int digits = 0;
+    for (std::uint64_t m = ~std::uint64_t(0); m; m /= b)
+      ++digits;
+    digits = std::max(digits, static_cast<unsigned int>(
+                                  std::ceil(53 / std::log2(double(b)))));
+    for (unsigned int k = 0; k < digits; ++k) {
+      multipliers.push_back(b > 2 ? rng.uniform_int(1, b - 1) : 1);
+      shifts.push_back(rng.uniform_int(0, b - 1));
+    }
+    offsets.push_back(offsets.back() + digits);
+  }
+}
+
+double Halton::radical_inverse(std::uint64_t i, unsigned int j) const {
+  const unsigned int b = bases[j];
+  const double inv = 1.0 / b;
+  double f = inv;
+  double result = 0;
+  if (shifts.empty()) {
+    for (; i; i /= b, f *= inv)
+      result += (i % b) * f;
+    return result;
+  }
+  for (unsigned int k = offsets[j]; k < offsets[j + 1]; ++k, i /= b, f *= inv) {
+    std::uint64_t d = i % b;
+    result += ((multipliers[k] * d + shifts[k]) % b) * f;
+  }
+  // The truncated digit expansion can round up to exactly 1
+  return std::min(result, 1 - std::ldexp(1.0, -53));
+}
+
+/**
+ * @brief Writes the next point, with coordinates in [0, 1), and advances.
+ */
+void Halton::next(double *point) {
+  for (unsigned int j = 0; j < dims; ++j)
+    point[j] = radical_inverse(n, j);
+  ++n;
+}
+
+/**
+ * @brief Writes the next count points row-major into out.
+ */
+void Halton::block(size_t count, double *out) {
+  for (size_t i = 0; i < count; ++i)
+    next(out + i * dims);
+}
+
+/**
+ * @brief Writes the next count points mapped to standard normal coordinates.
+ *
+ * Coordinates equal to 0 (only the unscrambled origin) are moved to 2^-33
+ * before the inverse normal CDF is applied.
+ */
+void Halton::block_normal(size_t count, double *out) {
+  for (size_t i = 0; i < count; ++i) {
+    double *point = out + i * dims;
+    for (unsigned int j = 0; j < dims; ++j)
+      point[j] = normal_quantile(open_unit(radical_inverse(n, j)));
+    ++n;
+  }
+}